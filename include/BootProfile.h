@@ -0,0 +1,31 @@
+/*
+ * BootProfile.h - timestamps of the setup() stages, from reset to first sample
+ *
+ * setup() marks the end of each stage; loop() marks the first sample taken
+ * and prints the profile once.  Times are micros() since the Arduino core
+ * started Timer0, so the bootloader's own delay is not included.
+ */
+
+#ifndef BootProfile_h
+#define BootProfile_h
+
+#include <Arduino.h>
+
+#define BOOT_STAGES_MAX  10
+
+class BootProfile
+{
+  public:
+    BootProfile();
+    void mark(const __FlashStringHelper *stage);	// end of a stage - F("name")
+    bool done(void) const { return _printed; }
+    void print(void);					// stage, time since reset & stage duration (ms) - once
+
+  private:
+    const __FlashStringHelper *_stage[BOOT_STAGES_MAX];
+    unsigned long _atUs[BOOT_STAGES_MAX];
+    uint8_t _count;
+    bool _printed;
+};
+
+#endif
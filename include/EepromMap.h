@@ -0,0 +1,12 @@
+/*
+ * EepromMap.h - allocation of the Mega 2560's 4KB EEPROM
+ */
+
+#ifndef EepromMap_h
+#define EepromMap_h
+
+#define EEPROM_TZ_RULES      100	// Timezone DST & STD TimeChangeRules (2 x 12 bytes)
+#define EEPROM_RUNTIME_CFG   200	// RuntimeConfig - settings changed by downlink
+#define EEPROM_LORA_SESSION  300	// LoraSession - OTAA session & frame counters (~70 bytes)
+
+#endif
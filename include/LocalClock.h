@@ -0,0 +1,34 @@
+/*
+ * LocalClock.h - incremental UTC to local time conversion
+ *
+ * Caches the current UTC offset and the UTC epoch of the next DST change, so
+ * converting a report time costs one compare and one add.  The Timezone rules
+ * are only consulted again once the change has passed (or the clock has been
+ * stepped back), i.e. about twice a year.
+ */
+
+#ifndef LocalClock_h
+#define LocalClock_h
+
+#include <TimeLib.h>
+#include <Timezone.h>
+
+class LocalClock
+{
+  public:
+    LocalClock(Timezone &tz);
+    time_t toLocal(time_t utc);
+    time_t nextLocalHour(time_t utc, uint8_t hr);			// UTC epoch of the next hr:00 local after utc
+    long offset(void) const { return _offset; }			// seconds east of UTC
+    time_t nextChange(void) const { return _nextChange; }	// UTC epoch of the next offset change
+
+  private:
+    Timezone &_tz;
+    long _offset;
+    time_t _validFrom;					// cached offset holds for _validFrom <= utc < _nextChange
+    time_t _nextChange;
+
+    void refresh(time_t utc);
+};
+
+#endif
@@ -0,0 +1,63 @@
+/*
+ * LoraSession.h - OTAA session kept in EEPROM across resets
+ *
+ * After EV_JOINED the negotiated session (NetID, DevAddr, session keys, frame
+ * counters, channel mask & RX parameters) is saved, so a watchdog reset or
+ * brown-out restores it straight into LMIC instead of rejoining.  The uplink
+ * counter is only written every SESSION_FCNT_STEP frames to spare the EEPROM;
+ * on restore it is advanced by that step so a counter is never reused.  The
+ * saved session is tied to the device credentials it was joined with - new
+ * keys in the sketch force a fresh join.
+ */
+
+#ifndef LoraSession_h
+#define LoraSession_h
+
+#include <Arduino.h>
+#include <lmic.h>
+
+#define SESSION_VERSION     1
+#define SESSION_FCNT_STEP   32			// uplinks between frame counter writes
+#define SESSION_CHANNEL_MAP 10			// bytes of LMIC.channelMap kept (72 AU915/US915 channels)
+#define SESSION_CHANNELS    72
+
+class LoraSession
+{
+  public:
+    LoraSession(const uint8_t *appEui, const uint8_t *devEui, const uint8_t *appKey);	// PROGMEM
+    bool restore(void);					// load a saved session into LMIC; false if none valid
+    void save(void);					// after EV_JOINED
+    void checkpoint(void);				// after EV_TXCOMPLETE - persists the frame counters
+    void forget(void);					// next boot rejoins
+
+  private:
+    struct Session {
+      uint8_t version;
+      uint16_t credentials;				// CRC of the keys the session was joined with
+      uint32_t netid;
+      uint32_t devaddr;
+      uint8_t nwkSKey[16];
+      uint8_t appSKey[16];
+      uint32_t seqnoUp;
+      uint32_t seqnoDn;
+      uint8_t channelMap[SESSION_CHANNEL_MAP];
+      uint8_t datarate;
+      uint8_t rx1DrOffset;
+      uint8_t rxDelay;
+      uint8_t dn2Dr;
+      uint16_t crc;
+    };
+
+    uint16_t credentialCrc(void) const;
+    static uint16_t crc(const Session &s);
+    static void restoreChannels(const uint8_t *map);
+    void write(void);
+
+    const uint8_t *_appEui;
+    const uint8_t *_devEui;
+    const uint8_t *_appKey;
+    uint32_t _savedSeqnoUp;
+    bool _valid;
+};
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * ObsCodec.h - keyframe / field-mask delta coding of reports
+ *
+ * Plain C++ (no Arduino dependencies) so the host decoder builds from the same
+ * source as the station encoder.  Reports are coded as records, each starting
+ * with a header byte: bit 7 set for a keyframe, bit 6 for an echo, bits 0-5
+ * the body length.
+ *   keyframe  the report in the port 1 layout (obsPayload)
+ *   delta     a diff from the keyframe/delta before it in the same frame
+ *   echo      a diff from the last keyframe/delta before it in the same frame -
+ *             a redundant copy of an earlier report (ObsEncoder::echo)
+ * A diff is a uint16 field mask, the varint frameBase difference (later minus
+ * earlier), then for each mask bit set, in bit order:
+ *   bits 0-9   zigzag varint change of that obsSet field
+ *   bit 10     zigzag varint gustOffset
+ *   bit 11     varint rainPeakX10, zigzag varint firstTipOffset
+ * Fields not in the mask are unchanged.  Every frame starts with a keyframe and
+ * nothing refers outside its frame, so each frame that arrives decodes in full
+ * whatever was lost before it: a lost frame costs only its own reports (and
+ * echoes in the following frames recover those).  The saving is in frames that
+ * batch several reports - a frame of one report is a keyframe.
+ */
+
+#ifndef ObsCodec_h
+#define ObsCodec_h
+
+#include <stdint.h>
+#include "ObsPayload.h"
+
+#define CODEC_KEY_FLAG   0x80
+#define CODEC_ECHO_FLAG  0x40
+#define CODEC_LEN_MASK   0x3F
+#define ObsFields        (sizeof(obsSet) / sizeof(uint16_t))
+#define CODEC_RECORD_MAX (1 + sizeof(obsPayload))	// a delta is only used when shorter than a keyframe
+#define CODEC_DIFF_MAX   (2 + 5 + ObsFields * 3 + 3 + 3 + 3)	// worst case diff
+#define Mask_Gust        (1 << ObsFields)
+#define Mask_Rain        (1 << (ObsFields + 1))
+
+#define Codec_Fail       0
+#define Codec_Report     1
+#define Codec_Echo       2
+
+class ObsEncoder
+{
+  public:
+    ObsEncoder();
+    void startFrame(void) { _haveLast = false; }	// next record will be a keyframe
+    uint8_t encode(const uint8_t *report, uint8_t len, uint8_t *out);	// record length (<= CODEC_RECORD_MAX)
+    // echo record of an earlier report, diffed from ref (the last report encoded in the frame).
+    // 0 if it would be no smaller than a keyframe
+    static uint8_t echo(const uint8_t *ref, uint8_t refLen, const uint8_t *report, uint8_t len, uint8_t *out);
+
+  private:
+    obsPayload _last;					// report of the last record in this frame
+    bool _haveLast;
+};
+
+class ObsDecoder
+{
+  public:
+    ObsDecoder();
+    void startFrame(void) { _haveLast = false; }	// call before the first record of each frame
+    // Decode the record at buf.  used is set to its length whenever the header is readable (0 if
+    // not), so a frame can be walked past records that can't be decoded.  Returns Codec_Report or
+    // Codec_Echo with the report in port 1 layout in out/len, Codec_Fail if it can't be decoded.
+    uint8_t decode(const uint8_t *buf, uint8_t avail, uint8_t &used, obsPayload &out, uint8_t &len);
+
+  private:
+    obsPayload _last;					// last keyframe/delta decoded in this frame - the reference
+    bool _haveLast;						// for the next delta or echo
+};
+
+#endif
@@ -0,0 +1,54 @@
+/*
+ * ObsPayload.h - uplink payload layout
+ *
+ * Shared by main.cpp and the modules that inspect or encode reports.  Fields
+ * are sent as little-endian uint16 (AVR native order).  Packed so that a host
+ * build of the decoder sees the same layout as the AVR, which never pads.
+ */
+
+#ifndef ObsPayload_h
+#define ObsPayload_h
+
+#include <stdint.h>
+
+// Define structures for handling reporting via TTN
+typedef struct obsSet {
+	uint16_t 	windGustX10; // observed windgust speed (km/h) X10  ~range 0 -> 1200
+	uint16_t	windGustDir; // observed wind direction of Gust (compass degrees)  0 -> 359
+	uint16_t	tempX10;	// observed temp (°C) +100 x 10   ~range -200->600
+	uint16_t	humidX10;	// observed relative humidty (%) x 10   range 0->1000
+	uint16_t 	pressX10;	// observed barometric pressure at station level (hPa)  x 10  ~range 8700 -> 11000 
+	uint16_t	rainflX10;	// observed accumulated rainfall (mm) x10   ~range 0->1200
+	uint16_t	windspX10;	// observed windspeed (km/h) x10 ~range 0->1200
+	uint16_t	windDir;	// observed wind direction (compass degrees)  range 0->359
+	uint16_t	dailyRainX10; //  accumulated rainfall (mm) X10 for period to 9am daily
+	uint16_t	casetempX10;		// station case temperature (for alarming)
+ } __attribute__((packed)) obsSet;
+
+#define TempX10_Disconnected  0xFFFF	// tempX10/casetempX10 value reported when a DS18B20 cannot be read
+#define ObsX10_NotFitted      0xFFFF	// value reported for a sensor not fitted (StationConfig.h)
+		
+// Optional trailer - only appended to the payload when rain fell during the report period
+typedef struct obsRainExt {
+	uint16_t	rainPeakX10;	// peak 1-minute rainfall intensity (mm/hr) x10
+	int16_t		firstTipOffset;	// first bucket tip of the period, in 0.5s ticks relative to frameBase
+ } __attribute__((packed)) obsRainExt;
+
+// Frame timestamp - every time in the payload is a 0.5s tick offset from frameBase
+typedef struct obsStamp {
+	uint32_t	frameBase;		// UTC epoch second at which the report was taken
+	int16_t		gustOffset;		// time of windGust, in 0.5s ticks relative to frameBase (<= 0)
+ } __attribute__((packed)) obsStamp;
+
+// Port 1 layout: obsSet, obsStamp, then obsRainExt only if it rained
+typedef struct obsPayload
+{
+	obsSet		obsReport;
+	obsStamp	stamp;
+	obsRainExt	rainExt;
+
+	uint8_t *readAccess(void) { return (uint8_t *)this; }	// the payload bytes
+	const uint8_t *readAccess(void) const { return (const uint8_t *)this; }
+} __attribute__((packed)) obsPayload;
+
+#endif
@@ -0,0 +1,31 @@
+/*
+ * PulseCounter.h - hardware pulse counting on the Mega's Timer/Counter5
+ *
+ * Timer5 is clocked from its external T5 input (PL2, Mega digital pin 47) so
+ * each sensor pulse increments TCNT5 without any interrupt.  Firmware reads
+ * the count once per sample.  There is no software debounce in this mode -
+ * the signal must be clean (sensor output conditioning or an RC filter).
+ *
+ * Of the Mega 2560's counter inputs only T0 (used by millis) and T5 reach the
+ * headers; T1, T3 and T4 are not bonded out, and Timer1 drives the sampler.
+ */
+
+#ifndef PulseCounter_h
+#define PulseCounter_h
+
+#include <Arduino.h>
+
+#define PulseCounter5_Pin  47		// T5 external clock input
+
+class PulseCounter5
+{
+  public:
+    PulseCounter5();
+    void begin(void);				// count falling edges on T5
+    uint16_t delta(void);			// pulses since the previous call.  Call from ISR or with interrupts off
+
+  private:
+    uint16_t _last;
+};
+
+#endif
@@ -0,0 +1,39 @@
+/*
+ * RainLog.h - per-tip rain gauge timestamps & peak intensity
+ *
+ * isr_rg() logs the station clock tick of every bucket tip into a lock-free
+ * ring.  At each report the new tips are scanned once with a sliding 1 minute
+ * window, giving the peak 1-minute tip count and the time of the period's
+ * first tip in constant time per tip.  Those two go in the report (obsRainExt);
+ * the stamps of the other tips are not sent.
+ */
+
+#ifndef RainLog_h
+#define RainLog_h
+
+#include <Arduino.h>
+#include "SpscRing.h"
+#include "StationClock.h"
+
+// 255 tips fit in the ring: one report period plus the trailing minute at up to ~500 mm/hr,
+// well above the heaviest 5-minute burst recorded at the station.
+#define RAIN_LOG_SIZE    256
+#define RainWindow_sec    60			// intensity window
+
+typedef uint16_t rainTick_t;			// low 16 bits of a station clock stamp - wraps after 9 hrs
+
+class RainLog
+{
+  public:
+    RainLog();
+    void tip(stamp_t now) { _tips.push((rainTick_t)now); }	// call from the rain gauge ISR per tip
+    bool summarise(stamp_t now, uint8_t &peakTips, stamp_t &firstTip);	// fold in tips since the last
+    															// call.  false if there were none
+    uint16_t overflows(void) const { return _tips.overflows(); }
+
+  private:
+    SpscRing<rainTick_t, RAIN_LOG_SIZE> _tips;
+    uint8_t _scanned;					// tips at the ring tail already included in a summary
+};
+
+#endif
@@ -0,0 +1,53 @@
+/*
+ * ReportFilter.h - change-driven reporting with per-channel deadbands
+ *
+ * Each completed report is compared with the last one that was sent.  It is
+ * only sent if some channel has moved by at least its deadband, or if
+ * heartbeat reports in a row would otherwise have been skipped.  Rain onset
+ * and a gust spike are urgent: urgent() is checked at every sample, and when
+ * it trips a report is made there and then, and sent without the usual
+ * report delay.
+ * A heartbeat of 0 sends every report (change-driven reporting off); a
+ * deadband of 0 stops that channel triggering a report.
+ */
+
+#ifndef ReportFilter_h
+#define ReportFilter_h
+
+#include <Arduino.h>
+#include "ObsPayload.h"
+
+typedef struct Deadbands {
+	uint8_t		heartbeat;			// most reports in a row to skip; 0 = send every report
+	uint8_t		tempX10;			// air & case temperature (°C x10)
+	uint8_t		pressX10;			// pressure (hPa x10)
+	uint8_t		humidX10;			// relative humidity (% x10)
+	uint8_t		windX10;			// wind speed & gust (km/h x10)
+	uint8_t		rainX10;			// rain rate (mm/hr x10) & daily total (mm x10)
+	uint8_t		gustSpikeX10;		// gust rise over the last sent report that is urgent (km/h x10)
+ } Deadbands;
+
+#define Report_Skip     0
+#define Report_Send     1
+#define Report_Urgent   2
+
+class ReportFilter
+{
+  public:
+    ReportFilter();
+    void setDeadbands(const Deadbands &d) { _bands = d; }
+    bool urgent(bool raining, uint16_t gustX10) const;	// rain since the last report / gust so far
+    uint8_t check(const obsSet &obs);	// Report_*.  A report that is not skipped becomes the reference
+    uint16_t skipped(void) const { return _skippedTotal; }
+
+  private:
+    static bool moved(uint16_t now, uint16_t ref, uint8_t band);
+
+    Deadbands _bands;
+    obsSet _ref;						// last report sent
+    bool _haveRef;
+    uint8_t _skipRun;					// reports skipped since the last one sent
+    uint16_t _skippedTotal;
+};
+
+#endif
@@ -0,0 +1,67 @@
+/*
+ * RuntimeConfig.h - station settings changed by downlink & kept in EEPROM
+ *
+ * The compile-time #defines in main.cpp are only the defaults.  A downlink on
+ * ConfigPort carries one or more commands, each an opcode byte followed by its
+ * value (multi-byte values little endian, as in the uplink payload):
+ *   0x01 u8   sample interval - Timing_Clock ticks per sample
+ *   0x02 u8   report interval - samples per report
+ *   0x03 u8   delay from report to transmission (s)
+ *   0x04 u8   air temp DS18B20 resolution (9-12 bits)
+ *   0x05 u8   case temp DS18B20 resolution (9-12 bits)
+ *   0x06 i16  vane offset from north (deg), within 359 of VANE_TABLE_OFFSET
+ *   0x07 u8   payload variant (TxVariant_Auto / _Full / _Compact / _Delta)
+ *   0x08 u8   change-driven reporting heartbeat (0 = send every report)
+ *   0x09-0x0E u8  deadbands: temp, pressure, humidity, wind, rain, gust spike
+ *   0x0F u8   redundancy - earlier reports echoed in each frame (0-2)
+ *   0xF0      restore the compiled-in defaults
+ * A downlink is applied only if every command in it is valid.  Settings are
+ * saved with a CRC, and main.cpp takes them up at the next report boundary.
+ * A saved vane offset is dropped if the firmware's default (the offset in the
+ * vane table) has changed since, i.e. the vane has been recalibrated.
+ */
+
+#ifndef RuntimeConfig_h
+#define RuntimeConfig_h
+
+#include <Arduino.h>
+#include "ReportFilter.h"
+
+#define ConfigPort        10			// downlink FPort for configuration commands
+#define CONFIG_VERSION    4				// bump when StationSettings changes layout
+#define MinReportSec      60			// shortest report period accepted by downlink
+
+typedef struct StationSettings {
+	uint8_t		sampleInterval;		// Timing_Clock ticks per sample
+	uint8_t		reportInterval;		// samples per report
+	uint8_t		txDelaySec;			// report to transmission delay
+	uint8_t		airResolution;		// DS18B20 bits
+	uint8_t		caseResolution;
+	int16_t		vaneOffset;			// vane offset from north (deg)
+	uint8_t		payloadVariant;		// TxVariant_*
+	Deadbands	deadbands;			// change-driven reporting
+	uint8_t		redundancy;			// earlier reports echoed per uplink
+ } StationSettings;
+
+class RuntimeConfig
+{
+  public:
+    RuntimeConfig(const StationSettings &defaults, unsigned long tickUs);
+    bool begin(void);					// load saved settings; false if none valid (defaults used)
+    bool handleDownlink(const uint8_t *cmd, uint8_t len);	// true if settings changed & were saved
+    const StationSettings &settings(void) const { return _settings; }
+    bool isPending(void) const { return _pending; }		// changed since the last take()
+    const StationSettings &take(void) { _pending = false; return _settings; }
+
+  private:
+    bool valid(const StationSettings &s) const;
+    void save(void);
+    static uint8_t crc(const StationSettings &s, int16_t vaneCal);
+
+    const StationSettings _defaults;
+    unsigned long _tickUs;
+    StationSettings _settings;
+    bool _pending;
+};
+
+#endif
@@ -0,0 +1,57 @@
+/*
+ * SampleClock.h - Timer1 sample clock disciplined by the SD2405 1Hz output
+ *
+ * Timer1 keeps generating the 0.5s Timing_Clock ticks, but its period is
+ * continuously trimmed against the RTC's frequency interrupt so the ticks stay
+ * phase-locked to RTC (UTC) seconds.  Every DISCIPLINE_WINDOW seconds the
+ * phase error between tick time and RTC time is measured (micros() gives the
+ * fraction of the current tick) and a simple PI loop sets the next period:
+ * the integral term tracks the MCU clock error, the proportional term pulls
+ * the remaining phase error out over the following window.
+ */
+
+#ifndef SampleClock_h
+#define SampleClock_h
+
+#include <Arduino.h>
+
+#define DISCIPLINE_WINDOW  16			// RTC seconds between period corrections
+#define MAX_TRIM_PPM       10000		// limit on period correction (resonator tolerance is ~0.5%)
+
+class SampleClock
+{
+  public:
+    SampleClock();
+    void begin(unsigned long periodUs);	// Timer1 must already be initialised to periodUs
+    void tick(void);					// call from the Timer1 ISR
+    void rtcEdge(void);					// call from the RTC 1Hz ISR
+    bool discipline(void);				// call from loop(); true once, when first locked to the RTC
+    bool isLocked(void) const { return _locked; }
+    unsigned long ticksSinceLock(void);
+    unsigned long secondsSinceLock(void);
+    void sinceLockISR(unsigned long &seconds, unsigned long &ticks) const { seconds = _seconds; ticks = _ticks; }	// interrupts off
+    long phaseErrorUs(void) const { return _phaseErr; }
+    long periodUs(void) const { return _period; }
+
+  private:
+    unsigned long _nominal;				// station time represented by one tick
+    long _base;							// integral term - period matching the MCU clock error
+    long _period;						// period currently programmed into Timer1
+    long _phaseErr;						// tick time - RTC time, at the last window edge (µs)
+    bool _reported;						// lock already reported by discipline()
+
+    // shared with the ISRs
+    volatile bool _locked;
+    volatile bool _measured;
+    volatile unsigned long _ticks;
+    volatile unsigned long _seconds;
+    volatile unsigned long _lastTickUs;
+    volatile unsigned long _edgeTicks;	// snapshot at the latest window edge
+    volatile unsigned long _edgeFracUs;
+    volatile long _newPeriod;			// period for tick() to program, 0 if none
+
+    unsigned long _prevTicks;
+    unsigned long _prevFracUs;
+};
+
+#endif
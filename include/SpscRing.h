@@ -0,0 +1,65 @@
+/*
+ * SpscRing.h - lock-free single-producer / single-consumer ring buffer
+ *
+ * Intended for handing data from one interrupt handler to loop().  The head
+ * index is only written by the producer and the tail only by the consumer, and
+ * both are single bytes, so neither side needs to disable interrupts.
+ * Size must be a power of two no greater than 256; one slot is kept free to
+ * tell a full ring from an empty one.
+ */
+
+#ifndef SpscRing_h
+#define SpscRing_h
+
+#include <stdint.h>
+
+#define SPSC_BARRIER()  __asm__ __volatile__("" ::: "memory")
+
+template <typename T, uint16_t Size>
+class SpscRing
+{
+  public:
+    SpscRing() : _head(0), _tail(0), _overflows(0) {}
+
+    // Producer side
+    bool push(const T &item) {
+      uint8_t head = _head;
+      if ((uint8_t)((head - _tail) & Mask) == Mask) {
+        if (_overflows != 0xFFFF) _overflows++;
+        return false;					// full - the item is dropped & counted
+      }
+      _buf[head & Mask] = item;
+      SPSC_BARRIER();					// item must be stored before it is published
+      _head = (head + 1) & Mask;
+      return true;
+    }
+
+    // Consumer side
+    uint8_t count(void) const { return (uint8_t)((_head - _tail) & Mask); }
+    bool isEmpty(void) const { return _head == _tail; }
+    T peek(uint8_t i) const {			// i < count()
+      SPSC_BARRIER();					// don't read the slot ahead of the head index
+      return _buf[(_tail + i) & Mask];
+    }
+    bool pop(T &item) {
+      if (isEmpty()) return false;
+      SPSC_BARRIER();
+      item = _buf[_tail];
+      SPSC_BARRIER();					// item must be copied before the slot is released
+      _tail = (_tail + 1) & Mask;
+      return true;
+    }
+    void drop(void) { if (!isEmpty()) _tail = (_tail + 1) & Mask; }
+    uint16_t overflows(void) const { return _overflows; }
+
+  private:
+    static const uint8_t Mask = (uint8_t)(Size - 1);
+    static_assert((Size & (Size - 1)) == 0 && Size >= 2 && Size <= 256, "SpscRing size must be a power of two <= 256");
+
+    T _buf[Size];
+    volatile uint8_t _head;
+    volatile uint8_t _tail;
+    volatile uint16_t _overflows;
+};
+
+#endif
@@ -0,0 +1,38 @@
+/*
+ * StationClock.h - monotonic station time from the Timing_Clock tick
+ *
+ * A free-running count of Timing_Clock (0.5s) ticks, incremented by isr_timer.
+ * Reading it from an ISR is a single 4 byte load, so rain tips, gusts and
+ * reports can all be stamped cheaply.  The count is mapped to UTC by one sync
+ * against the RTC's whole seconds - at boot, or exactly at the RTC second edge
+ * when the sample clock is disciplined (TIMER_DISCIPLINED).
+ */
+
+#ifndef StationClock_h
+#define StationClock_h
+
+#include <Arduino.h>
+#include <TimeLib.h>
+
+#define STATION_TICKS_PER_SEC  2		// = 1000000 / Timing_Clock
+
+typedef uint32_t stamp_t;				// ticks since boot
+
+class StationClock
+{
+  public:
+    StationClock();
+    void tick(void) { _ticks++; }						// call from the Timing_Clock ISR
+    stamp_t nowISR(void) const { return _ticks; }		// only from ISR context (interrupts off)
+    stamp_t now(void) const;
+    void sync(time_t utc, stamp_t at);					// second utc began at tick at
+    time_t toUtc(stamp_t t) const;						// UTC second that tick t falls in
+    int32_t ticksFrom(time_t utc, stamp_t t) const;		// tick t relative to the start of second utc
+
+  private:
+    volatile stamp_t _ticks;
+    time_t _baseUtc;					// kept in seconds - ticks since 1970 pass 32 bits in 2038
+    stamp_t _baseStamp;
+};
+
+#endif
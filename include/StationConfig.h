@@ -0,0 +1,67 @@
+/*
+ * StationConfig.h - compile-time station timing & sensor set
+ *
+ * main.cpp names its Timing_Clock, Sample_Interval and Report_Interval (and
+ * which sensors are fitted) once, as the parameters of a StationConfig type.
+ * Everything that depends on them is worked out here by the compiler, and the
+ * timing invariants are checked with static_assert, so a change to any one of
+ * them can no longer leave a hand-computed constant behind.
+ *
+ * Sensors that are not fitted select a stand-in type with the same interface,
+ * so their driver is never referenced and drops out of the build.  A value
+ * from a sensor that is not fitted is reported as ObsX10_NotFitted.
+ *
+ * The interval parameters are the defaults - a downlink may change them at
+ * runtime (RuntimeConfig.h), within the limits checked there.
+ */
+
+#ifndef StationConfig_h
+#define StationConfig_h
+
+#include <Arduino.h>
+
+#define Ds18b20ConvUs      750000UL		// 12 bit conversion - harvested before the next sample
+
+// Pick A or B at compile time (no <type_traits> on AVR)
+template <bool UseA, typename A, typename B> struct StationSelect { typedef A type; };
+template <typename A, typename B> struct StationSelect<false, A, B> { typedef B type; };
+
+// Stand-in for the BME280 when no barometer is fitted
+class NoBarometer
+{
+  public:
+    bool begin(void) { return true; }
+    void readSensor(void) { }
+    bool requestSensor(void) { return false; }
+    bool poll(void) { return false; }
+    float getHumidity(void) { return 0; }
+    float getPressure_MB(void) { return 0; }
+};
+
+template <uint32_t TickUs, uint8_t SampleTicks, uint8_t ReportSamples, bool Barometer, uint8_t TempBuses>
+struct StationConfig
+{
+    static constexpr uint32_t tickUs = TickUs;
+    static constexpr uint8_t ticksPerSec = 1000000UL / TickUs;
+    static constexpr uint8_t sampleTicks = SampleTicks;
+    static constexpr uint8_t reportSamples = ReportSamples;
+    static constexpr uint32_t sampleUs = TickUs * SampleTicks;
+    static constexpr uint16_t reportSec = (uint32_t)SampleTicks * ReportSamples / ticksPerSec;
+    static constexpr bool hasBarometer = Barometer;
+    static constexpr uint8_t tempBuses = TempBuses;
+
+    // Wind speed in km/h x 10 from one rotation in one tick, Q16, for an anemometer giving
+    // kmhPerHz km/h per rotation/sec.  Divide by the ticks per sample for the per-sample factor
+    static constexpr uint32_t windX10PerRotTickQ16(double kmhPerHz) {
+        return (uint32_t)(kmhPerHz * 10 * 1000000.0 / TickUs * 65536 + 0.5);
+    }
+
+    static_assert(1000000UL % TickUs == 0, "Timing_Clock must divide one second");
+    static_assert(1000000UL / TickUs <= 255, "Timing_Clock too short - ticksPerSec is 8 bits");
+    static_assert((uint32_t)SampleTicks * ReportSamples % ticksPerSec == 0,
+                  "the report interval must be a whole number of seconds");
+    static_assert(SampleTicks >= 1 && ReportSamples >= 1, "a sample & a report each need at least one tick / sample");
+    static_assert(Ds18b20ConvUs < sampleUs, "DS18B20 conversions must complete within a sample interval");
+};
+
+#endif
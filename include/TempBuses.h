@@ -0,0 +1,42 @@
+/*
+ * TempBuses.h - coordinated DS18B20 acquisition across several 1-Wire buses
+ *
+ * Each bus is driven by its own DallasTemperature instance (see the library's
+ * Multibus_simple example).  Conversions are started on every bus together and
+ * each bus is harvested as soon as its own conversion completes, so acquisition
+ * time is set by the slowest bus rather than the sum of all of them.
+ */
+
+#ifndef TempBuses_h
+#define TempBuses_h
+
+#include <DallasTemperature.h>
+
+#define MAX_TEMP_BUSES   4			// buses handled by one coordinator
+#define MAX_TEMP_PROBES  8			// probes (across all buses) with cached readings
+
+class TempBuses
+{
+  public:
+    TempBuses(DallasTemperature *buses, uint8_t busCount);
+    void begin(void);									// enumerate buses & switch them to async conversions
+    int8_t addProbe(uint8_t bus, const uint8_t *deviceAddress);	// returns probe index, or -1 if table full
+    void requestTemperatures(void);						// start a conversion on all buses at once, unless any still pending
+    bool harvest(void);									// read buses that have completed; true when none pending
+    int16_t getTemp(uint8_t probe);						// last raw reading (1/128 °C) or DEVICE_DISCONNECTED_RAW
+
+  private:
+    DallasTemperature *_buses;
+    uint8_t _busCount;
+    uint8_t _probeCount;
+    uint8_t _pending;					// bitmask of buses with a conversion in progress
+    unsigned long _started;				// millis() when the current conversions were started
+    int16_t _waitMs[MAX_TEMP_BUSES];		// worst case conversion time for each bus
+    uint8_t _probeBus[MAX_TEMP_PROBES];
+    DeviceAddress _probeAddr[MAX_TEMP_PROBES];
+    int16_t _probeRaw[MAX_TEMP_PROBES];
+
+    void readBus(uint8_t bus);
+};
+
+#endif
@@ -0,0 +1,126 @@
+/*
+ * TxPlanner.h - airtime-aware scheduling of LoRaWAN uplinks
+ *
+ * Completed reports are queued here rather than sent blindly.  Each time a
+ * send is possible, the planner works out the time-on-air of the candidate
+ * frames at the current data rate and picks the one that clears the most
+ * queued observations within the airtime it may spend:
+ *  - port 1  one full report (obsSet + obsStamp [+ obsRainExt]) - as before
+ *  - port 2  several full reports, each preceded by its length byte
+ *  - port 3  compact batch: frameBase of the oldest report, then obsSet only
+ *            for consecutive reports one report interval apart
+ *  - port 4  keyframe / delta records (ObsCodec.h), each frame decodable on
+ *            its own - with TxVariant_Delta, or whenever redundancy is on:
+ *            each frame then also carries echoes of the last 1 or 2 reports
+ *            sent, for the host to recover a lost frame (the oldest dropped
+ *            first, as far as the budget can't afford them)
+ * Spending is paced by a token bucket refilled at TX_BUDGET_MS per day, and a
+ * rolling 24 hour ledger of hourly totals guarantees the daily budget (TTN
+ * fair use) is never exceeded.  When a frame won't fit, reports are held and
+ * go out batched later - retryInSec() says when the budget will allow the
+ * oldest of them - and if the queue fills, the oldest report is dropped.
+ *
+ * Only the current data rate (LMIC's, under ADR) is costed: a slower rate
+ * never has less airtime or a larger payload limit, and a faster one is not
+ * known to reach a gateway.
+ */
+
+#ifndef TxPlanner_h
+#define TxPlanner_h
+
+#include <Arduino.h>
+#include <TimeLib.h>
+#include "SpscRing.h"
+#include "ObsCodec.h"
+
+#define TX_BUDGET_MS      30000UL		// uplink airtime allowed per rolling 24 hrs (TTN fair use)
+#define TX_BURST_HOURS    2				// token bucket holds at most this many hours' share
+#define TX_MAC_OVERHEAD   13			// LoRaWAN MHDR + FHDR + FPort + MIC bytes
+#define TX_FRAME_MAX      128			// largest application payload built
+#define OBS_QUEUE_SIZE    8				// reports held awaiting transmission (one slot kept free)
+#define OBS_RECORD_MAX    32			// largest single report
+#define REDUNDANCY_MAX    2				// earlier reports echoed in each frame (at most)
+
+#define TxPort_Single     1
+#define TxPort_Batch      2
+#define TxPort_Compact    3
+#define TxPort_Delta      4
+
+#define TxVariant_Auto    0				// full reports, compact batch when it clears more of the queue
+#define TxVariant_Full    1				// never compact
+#define TxVariant_Compact 2				// always compact
+#define TxVariant_Delta   3				// keyframes & field-mask deltas
+
+class TxPlanner
+{
+  public:
+    struct ObsRecord {
+      uint32_t frameBase;
+      uint8_t len;
+      uint8_t data[OBS_RECORD_MAX];
+    };
+    struct Budget {						// airtime spending state (for WarmStart)
+      uint32_t tokensUs;
+      time_t lastRefill;
+      uint16_t ledgerMs[24];
+      uint32_t ledgerHour;
+    };
+
+    TxPlanner(uint8_t coreLen);
+    void setInterval(uint16_t intervalSec) { _interval = intervalSec; }	// report period
+    void setVariant(uint8_t variant) { _variant = variant; }
+    void setRedundancy(uint8_t echoes) { _redundancy = (echoes > REDUNDANCY_MAX) ? REDUNDANCY_MAX : echoes; }
+    bool enqueue(const uint8_t *report, uint8_t len, uint32_t frameBase);	// false if the oldest was dropped
+    bool plan(time_t now, uint8_t dr);	// build the next frame; false to hold the queue
+    uint8_t *frame(void) { return _frame; }
+    uint8_t frameLength(void) const { return _frameLen; }
+    uint8_t framePort(void) const { return _framePort; }
+    void sent(time_t now);				// the planned frame was handed to LMIC - charge & release it
+    uint32_t retryInSec(time_t now, uint8_t dr);	// until the oldest held report fits the budget; 0 = now
+    uint8_t held(ObsRecord *out, uint8_t max) const;	// copy of the queue, oldest first (for WarmStart)
+    void restore(const ObsRecord *in, uint8_t n);	// queue reports held before a reset
+    void budget(Budget &out) const;
+    void restoreBudget(const Budget &in);	// so a reset can't start a fresh hour's share
+
+    static uint32_t airtimeUs(uint8_t dr, uint8_t payloadLen);
+    static uint8_t maxPayload(uint8_t dr);
+
+    // counters
+    uint32_t usedMs(time_t now);		// airtime in the last 24 hrs
+    uint32_t remainingMs(time_t now) { uint32_t u = usedMs(now); return (u < TX_BUDGET_MS) ? TX_BUDGET_MS - u : 0; }
+    uint8_t pending(void) const { return _queue.count(); }
+    uint16_t framesSent(void) const { return _framesSent; }
+    uint16_t obsSent(void) const { return _obsSent; }
+    uint16_t obsDropped(void) const { return _obsDropped; }
+    uint32_t lastAirtimeUs(void) const { return _plannedAirUs; }
+
+  private:
+    void refill(time_t now);
+    void rollLedger(time_t now);
+    uint8_t build(uint8_t port, uint8_t maxLen, uint8_t echoes = 0);	// fills _frame, returns the reports it holds
+
+    SpscRing<ObsRecord, OBS_QUEUE_SIZE> _queue;
+    uint8_t _coreLen;
+    uint16_t _interval;
+    uint8_t _variant;
+    uint8_t _redundancy;
+    ObsRecord _history[REDUNDANCY_MAX];	// last reports sent, newest first - echoed by later frames
+    uint8_t _historyCount;
+
+    uint8_t _frame[TX_FRAME_MAX];
+    uint8_t _frameLen;
+    uint8_t _framePort;
+    uint8_t _plannedObs;
+    uint32_t _plannedAirUs;
+
+    uint32_t _tokensUs;
+    time_t _lastRefill;
+    uint16_t _ledgerMs[24];				// airtime per UTC hour, indexed by hour % 24
+    uint32_t _ledgerHour;				// UTC hour of the newest ledger entry
+
+    uint16_t _framesSent;
+    uint16_t _obsSent;
+    uint16_t _obsDropped;
+};
+
+#endif
@@ -0,0 +1,52 @@
+/*
+ * VaneAdc.h - background oversampling of the wind vane on the Mega's ADC
+ *
+ * The ADC is auto-triggered by the Timer0 overflow that already drives
+ * millis(), so the vane is converted ~976 times a second with no extra timer
+ * and no busy wait.  The ADC complete interrupt adds each reading to the
+ * running sum for the current sample interval, and isr_timer takes the mean
+ * once per interval - about 2440 readings per 2.5s sample.
+ *
+ * The vane wraps from 1023 back to 0 at north, so readings are summed as
+ * offsets from the first reading of the interval, each taken the short way
+ * round the circle.  The mean stays correct for a vane swinging across north,
+ * as long as it covers less than half a turn within one interval.
+ *
+ * analogRead() must not be used on any pin while this is running.
+ *
+ * Readings are turned into bearings by a 65 entry table (VaneTable.h) with
+ * linear interpolation between entries.  The table follows the vane's
+ * resistor ladder, measured by a calibration sweep, and already includes the
+ * mounting offset - so no multiply or divide is needed per reading.
+ */
+
+#ifndef VaneAdc_h
+#define VaneAdc_h
+
+#include <Arduino.h>
+
+#define VANE_ADC_COUNTS  1024		// one full turn of the vane
+
+class VaneAdc
+{
+  public:
+    VaneAdc();
+    void begin(uint8_t channel);		// ADC channel (0-15), e.g. WindVane_Pin - A0
+    uint16_t take(void);				// mean reading since the last take.  Call from ISR or with interrupts off
+    uint16_t readings(void) const { return _lastCount; }	// readings in the last mean
+    void convert(uint16_t reading);		// from the ADC complete ISR only
+
+    // Calibrated bearing (0-3599 tenths of a degree) of a reading, interpolated from the
+    // PROGMEM table generated by tools/vane_table.py, which includes tableOffset() degrees
+    static int16_t bearingX10(uint16_t counts);
+    static int16_t tableOffset(void);
+
+  private:
+    int32_t _sum;						// offsets from _ref this interval
+    uint16_t _count;
+    uint16_t _ref;						// first reading of the interval
+    uint16_t _mean;						// last mean, repeated if an interval had no readings
+    uint16_t _lastCount;
+};
+
+#endif
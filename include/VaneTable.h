@@ -0,0 +1,29 @@
+/*
+ * VaneTable.h - wind vane ADC counts to bearing, tenths of a degree
+ *
+ * Generated by tools/vane_table.py - do not edit.
+ *   sweep:  linear (no sweep)
+ *   offset: 0 deg (VaneOffset)
+ * Entry i is the bearing at 16 * i counts; VaneAdc::bearingX10() interpolates between.
+ */
+
+#ifndef VaneTable_h
+#define VaneTable_h
+
+#define VANE_TABLE_OFFSET  0		// deg folded into the table - main.cpp's VaneOffset default
+
+#ifdef VANE_TABLE_DATA			// VaneAdc.cpp only - elsewhere just the offset
+static const uint16_t vaneTable[65] PROGMEM = {
+	   0,   56,  112,  169,  225,  281,  338,  394,
+	 450,  506,  562,  619,  675,  731,  788,  844,
+	 900,  956, 1012, 1069, 1125, 1181, 1238, 1294,
+	1350, 1406, 1462, 1519, 1575, 1631, 1688, 1744,
+	1800, 1856, 1912, 1969, 2025, 2081, 2138, 2194,
+	2250, 2306, 2362, 2419, 2475, 2531, 2588, 2644,
+	2700, 2756, 2812, 2869, 2925, 2981, 3038, 3094,
+	3150, 3206, 3262, 3319, 3375, 3431, 3488, 3544,
+	   0,
+};
+#endif
+
+#endif
@@ -0,0 +1,64 @@
+/*
+ * WarmStart.h - watchdog supervision & state kept in RAM over a reset
+ *
+ * The watchdog is armed early in setup() and fed from loop(), so an I2C or
+ * 1-Wire lockup resets the station rather than hanging it.  After each batch
+ * of samples, loop() checkpoints the rain & wind accumulators, the report
+ * phase, the reports awaiting transmission and the airtime budget into a
+ * .noinit RAM region that the C runtime leaves alone at startup.  The region
+ * is CRC protected, so a reset part way through a checkpoint is seen as a
+ * cold start.  After a watchdog, brown-out or reset button reset, setup()
+ * takes the state back and the station carries on where it left off - and a
+ * reset loop can't overspend the airtime budget.
+ *
+ * NB: the Mega needs a bootloader that clears the watchdog (Optiboot, or the
+ * stk500v2 shipped since 2014), otherwise a watchdog reset loops in the
+ * bootloader.  The stk500v2 bootloader also clears MCUSR before starting the
+ * sketch, so the reset cause is lost: resetCause() is 0 and a power-on reset
+ * is only told from a warm one by the CRC (random RAM passes it about 1 time
+ * in 65536).  Optiboot passes the flags in r2 - define WARM_OPTIBOOT_R2 to
+ * take them from there, and power-on resets are then always cold starts.
+ */
+
+#ifndef WarmStart_h
+#define WarmStart_h
+
+#include <Arduino.h>
+#include <avr/wdt.h>
+#include "TxPlanner.h"
+
+//#define WARM_OPTIBOOT_R2 1			// Uncomment with Optiboot - reset flags passed in r2, not MCUSR
+
+#define WARM_VERSION    3
+#define WARM_OBS_MAX    (OBS_QUEUE_SIZE - 1)	// the whole TxPlanner queue
+#define WARM_WATCHDOG   WDTO_2S					// longest loop() or setup() may run unfed
+
+typedef struct WarmState {
+	uint32_t	tipCount;			// rain tips since the daily reset
+	uint32_t	dailyRainfallCount;	// tipCount at the last report
+	uint32_t	nextEodUtc;			// daily rollover due - not recomputed, so one missed while down still runs
+	uint16_t	sampleCount;		// report phase - samples into the current report
+	uint16_t	reportStartCount;	// sampleCount at an urgent report this cycle, else 0
+	uint16_t	windGustX10;
+	int16_t		calGustDirn;
+	uint8_t		obsCount;
+	TxPlanner::ObsRecord obs[WARM_OBS_MAX];	// reports awaiting transmission, oldest first
+	TxPlanner::Budget budget;		// airtime token bucket & 24 hour ledger
+ } WarmState;
+
+class WarmStart
+{
+  public:
+    bool restore(void);					// true if a checkpoint survived the reset intact
+    WarmState &state(void);				// fill in, then commit()
+    void commit(void);					// seal the checkpoint with its CRC
+    void arm(void) { wdt_enable(WARM_WATCHDOG); }
+    void feed(void) { wdt_reset(); }
+    uint8_t resetCause(void) const;		// MCUSR flags of the last reset - 0 if the bootloader cleared them
+    bool wasWatchdog(void) const { return resetCause() & (1 << WDRF); }
+
+  private:
+    static uint16_t crc(void);
+};
+
+#endif
@@ -333,6 +333,60 @@ bool DallasTemperature::setResolution(const uint8_t* deviceAddress,
 }
 
 
+// read the device's configuration once and compare it with the wanted resolution
+// and alarm bytes; the scratchpad is only written (and copied to EEPROM when
+// autoSaveScratchPad is set) if something actually differs.  The global
+// bitResolution is left alone - call begin() afterwards to recalculate it.
+bool DallasTemperature::syncScratchPad(const uint8_t* deviceAddress,
+		uint8_t newResolution, int8_t highAlarm, int8_t lowAlarm) {
+
+	ScratchPad scratchPad;
+	if (!isConnected(deviceAddress, scratchPad))
+		return false;
+
+	// make sure the alarm temperatures are within the device's range
+	highAlarm = constrain(highAlarm, -55, 125);
+	lowAlarm = constrain(lowAlarm, -55, 125);
+
+	bool changed = false;
+	if ((int8_t) scratchPad[HIGH_ALARM_TEMP] != highAlarm) {
+		scratchPad[HIGH_ALARM_TEMP] = (uint8_t) highAlarm;
+		changed = true;
+	}
+	if ((int8_t) scratchPad[LOW_ALARM_TEMP] != lowAlarm) {
+		scratchPad[LOW_ALARM_TEMP] = (uint8_t) lowAlarm;
+		changed = true;
+	}
+
+	// DS1820 and DS18S20 have no resolution configuration register
+	if (deviceAddress[DSROM_FAMILY] != DS18S20MODEL) {
+		uint8_t newValue;
+		switch (constrain(newResolution, 9, 12)) {
+		case 12:
+			newValue = TEMP_12_BIT;
+			break;
+		case 11:
+			newValue = TEMP_11_BIT;
+			break;
+		case 10:
+			newValue = TEMP_10_BIT;
+			break;
+		case 9:
+		default:
+			newValue = TEMP_9_BIT;
+			break;
+		}
+		if (scratchPad[CONFIGURATION] != newValue) {
+			scratchPad[CONFIGURATION] = newValue;
+			changed = true;
+		}
+	}
+
+	if (changed)
+		writeScratchPad(deviceAddress, scratchPad);
+	return true;
+}
+
 // returns the global resolution
 uint8_t DallasTemperature::getResolution() {
 	return bitResolution;
@@ -120,6 +120,11 @@ public:
 	bool setResolution(const uint8_t*, uint8_t,
 			bool skipGlobalBitResolutionCalculation = false);
 
+	// brings a device's resolution and TH/TL alarm bytes to the given values,
+	// writing the scratchpad (and EEPROM) only if one of them differs.
+	// returns true if the device is connected and already, or now, in sync
+	bool syncScratchPad(const uint8_t*, uint8_t, int8_t, int8_t);
+
 	// sets/gets the waitForConversion flag
 	void setWaitForConversion(bool);
 	bool getWaitForConversion(void);
@@ -0,0 +1,62 @@
+/*
+ * I2CRegisterDevice.cpp - register-mapped I2C devices on TwiEngine
+ */
+
+#include "I2CRegisterDevice.h"
+
+// One transaction, retried.  TwiEngine has recovered a stuck bus by the time transfer() returns
+bool I2CDevice::run(TwiXfer &x)
+{
+	for (uint8_t attempt = 0; attempt <= I2C_RETRIES; attempt++) {
+		_status = Twi.transfer(&x);
+		if (_status == TWI_OK)
+			return true;
+		if (_errors != 0xFFFF) _errors++;
+	}
+	return false;
+}
+
+bool I2CDevice::read(uint8_t reg, uint8_t *buf, uint8_t n)
+{
+	TwiXfer x;
+	x.set(_addr, &reg, 1, buf, n);		// repeated start - keep the bus for the read
+	if (run(x))
+		return true;
+	memset(buf, 0, n);
+	return false;
+}
+
+bool I2CDevice::write(uint8_t reg, const uint8_t *buf, uint8_t n)
+{
+	uint8_t tx[I2C_WRITE_MAX + 1];
+	if (n > I2C_WRITE_MAX)
+		return false;
+	tx[0] = reg;
+	memcpy(&tx[1], buf, n);
+	TwiXfer x;
+	x.set(_addr, tx, n + 1, 0, 0);
+	return run(x);
+}
+
+bool I2CDevice::probe(void)
+{
+	TwiXfer x;
+	x.set(_addr, 0, 0, 0, 0);
+	_status = Twi.transfer(&x);
+	return _status == TWI_OK;
+}
+
+bool I2CDevice::submitRead(TwiXfer &x, const uint8_t *reg, uint8_t *buf, uint8_t n)
+{
+	x.set(_addr, reg, 1, buf, n);
+	return Twi.submit(&x);
+}
+
+// Every attempt timing out behind a full queue of transactions that time out too (none longer
+// than this one), plus a bus recovery (~250us with clock stretching) for each
+unsigned long I2CDevice::worstCaseUs(uint8_t n) const
+{
+	TwiXfer x;
+	x.set(_addr, 0, 1, 0, n);			// a read - one byte longer than the write
+	return (I2C_RETRIES + 1) * (TWI_QUEUE_SIZE * (Twi.timeoutUs(&x) + 250));
+}
@@ -0,0 +1,64 @@
+/*
+ * I2CRegisterDevice.h - register-mapped I2C devices on TwiEngine
+ *
+ * The register access every driver repeats - a burst read after a register
+ * address (repeated start), a burst write, single registers and a background
+ * read - with bounded timing:
+ *  - each attempt is given up TwiEngine::timeoutUs() after it starts, and
+ *    a bus left stuck (timeout, bus error, lost arbitration) is recovered
+ *  - a failed attempt is retried I2C_RETRIES times
+ * so a call takes at most worstCaseUs(n) however the bus misbehaves.  A
+ * background read is timed out as it is polled with readDone().
+ *
+ * I2CRegisterDevice<Addr> fixes the address at compile time.  A driver whose
+ * address is chosen at runtime (BME280 at 0x76 or 0x77) uses the I2CDevice
+ * it derives from.
+ */
+
+#ifndef I2CRegisterDevice_h
+#define I2CRegisterDevice_h
+
+#include <Arduino.h>
+#include "TwiEngine.h"
+
+#define I2C_RETRIES      2				// further attempts after a failure
+#define I2C_WRITE_MAX    16				// longest register burst written
+
+class I2CDevice
+{
+  public:
+    I2CDevice(uint8_t addr) { _addr = addr; _status = TWI_OK; _errors = 0; }
+    uint8_t address(void) const { return _addr; }
+    void setAddress(uint8_t addr) { _addr = addr; }
+
+    bool read(uint8_t reg, uint8_t *buf, uint8_t n);		// false (buf zeroed) after all retries fail
+    bool write(uint8_t reg, const uint8_t *buf, uint8_t n);	// n <= I2C_WRITE_MAX
+    uint8_t read8(uint8_t reg) { uint8_t v; read(reg, &v, 1); return v; }
+    bool write8(uint8_t reg, uint8_t v) { return write(reg, &v, 1); }
+    bool probe(void);					// device answers its address - not retried
+
+    // Background burst read: x, reg & buf are the caller's until readDone().  Not retried
+    bool submitRead(TwiXfer &x, const uint8_t *reg, uint8_t *buf, uint8_t n);
+    bool readDone(TwiXfer &x) { Twi.service(); return x.done(); }	// finished, or timed out (x.status)
+
+    unsigned long worstCaseUs(uint8_t n) const;		// longest read() or write() of n bytes
+    uint8_t lastStatus(void) const { return _status; }	// TwiXfer status of the last attempt
+    uint16_t errors(void) const { return _errors; }		// failed attempts
+
+  private:
+    bool run(TwiXfer &x);
+
+    uint8_t _addr;
+    uint8_t _status;
+    uint16_t _errors;
+};
+
+template <uint8_t Addr>
+class I2CRegisterDevice : public I2CDevice
+{
+  public:
+    static const uint8_t addr = Addr;
+    I2CRegisterDevice() : I2CDevice(Addr) { }
+};
+
+#endif
@@ -0,0 +1,263 @@
+/*
+ * TwiEngine.cpp - interrupt-driven I2C transactions on the AVR TWI
+ */
+
+#include <util/twi.h>
+#include "TwiEngine.h"
+
+#define QueueMask  (TWI_QUEUE_SIZE - 1)
+#define TwcrReply  ((1 << TWINT) | (1 << TWEN) | (1 << TWIE))
+#define TWI_STRETCH_MAX  100			// us a slave may hold SCL low during bus recovery
+#define TWI_STOP_SPINS   1000			// ~0.4ms at 16MHz for a STOP to complete - one SCL period normally
+
+static_assert((TWI_QUEUE_SIZE & QueueMask) == 0, "TWI_QUEUE_SIZE must be a power of two");
+
+TwiEngine::TwiEngine()
+{
+	_head = 0;
+	_tail = 0;
+	_index = 0;
+	_reading = false;
+	_begun = false;
+	_stuck = false;
+	_hz = TWI_STANDARD;
+	_bitUs = 10;
+	_startedUs = 0;
+}
+
+void TwiEngine::begin(void)
+{
+	if (_begun)
+		return;
+	digitalWrite(SDA, HIGH);			// internal pull-ups, as Wire - external ones still advised
+	digitalWrite(SCL, HIGH);
+	_begun = true;
+	setClock(_hz);
+	TWCR = (1 << TWEN);
+}
+
+// SCL = F_CPU / (16 + 2 TWBR), prescaler 1.  Before begin() the rate is only kept, for
+// begin() to apply - so it doesn't matter which is called first
+void TwiEngine::setClock(uint32_t hz)
+{
+	_hz = hz;
+	_bitUs = (1000000UL + hz - 1) / hz;
+	if (!_begun)
+		return;
+	TWSR = 0;
+	TWBR = ((F_CPU / hz) - 16) / 2;
+}
+
+// Address, data & ACK bits (9 per byte), a second address for a read, start & stop
+unsigned long TwiEngine::timeoutUs(const TwiXfer *x) const
+{
+	uint16_t bytes = 1 + x->txLen + (x->rxLen ? 1 + x->rxLen : 0);
+	return (unsigned long)(bytes * 9 + 4) * _bitUs * 4 + TWI_TIMEOUT_MARGIN;
+}
+
+bool TwiEngine::submit(TwiXfer *x)
+{
+	uint8_t sreg = SREG;
+	noInterrupts();
+	if (((_head - _tail) & QueueMask) == QueueMask) {
+		SREG = sreg;
+		x->status = TWI_QUEUE_FULL;
+		return false;
+	}
+	x->status = TWI_BUSY;
+	bool idle = (_head == _tail);
+	_queue[_head] = x;
+	_head = (_head + 1) & QueueMask;
+	if (idle && !_stuck)				// a stuck bus starts the queue once service() has freed it
+		start();
+	SREG = sreg;
+	return true;
+}
+
+// Transactions queued ahead (background reads) are each timed from their own start
+uint8_t TwiEngine::transfer(TwiXfer *x)
+{
+	if (!submit(x))
+		return x->status;
+	while (!x->done())
+		service();
+	service();							// free the bus if this transaction's STOP hung
+	return x->status;
+}
+
+// Abandon the transaction in progress if it has run past its timeout, or recover the bus if
+// the ISR left it stuck (hung STOP, bus error, lost arbitration) - the one place it is recovered.
+// Called by transfer() as it waits; a driver with a background read calls it while polling, so
+// a read on a hung bus is still given up (& the bus freed) in bounded time.  The recovery runs
+// with interrupts on: the TWI is switched off (so no TWI interrupt) and the queue held meanwhile
+void TwiEngine::service(void)
+{
+	uint8_t sreg = SREG;
+	noInterrupts();
+	if (_recovering) {					// already under way further up the stack
+		SREG = sreg;
+		return;
+	}
+	if (!_stuck && (_head != _tail) && (micros() - _startedUs > timeoutUs(_queue[_tail])))
+		abort();
+	bool recover = _stuck;
+	if (recover) {
+		_recovering = true;
+		TWCR = 0;						// engine out of service - pins become plain I/O
+	}
+	SREG = sreg;
+	if (!recover)
+		return;
+	recoverBus();
+	noInterrupts();
+	TWCR = (1 << TWEN);
+	_stuck = false;
+	_recovering = false;
+	if (_head != _tail)
+		start();
+	SREG = sreg;
+}
+
+// Give up on the transaction in progress & leave the bus for service() to free.  Interrupts off
+void TwiEngine::abort(void)
+{
+	TwiXfer *x = _queue[_tail];
+	_tail = (_tail + 1) & QueueMask;
+	x->status = TWI_TIMEOUT;
+	_stuck = true;
+	if (x->callback)
+		x->callback(x);
+}
+
+// A slave interrupted mid-byte (e.g. by a reset of this MCU) may hold SDA low, waiting for
+// clocks.  With the TWI off (service()), clock SCL until SDA is released (9 at most), then send
+// a STOP so every slave is idle.  Pins are driven open-drain: the PORT bit is cleared before a
+// pin is made an output, so it only ever pulls low, and released as a pulled up input.  Up to
+// ~1ms with clock stretching - interrupts stay on, and a late edge only lengthens a clock
+void TwiEngine::recoverBus(void)
+{
+	pinMode(SDA, INPUT_PULLUP);
+	pinMode(SCL, INPUT_PULLUP);
+	releaseScl();
+	for (uint8_t i = 0; (i < 9) && !digitalRead(SDA); i++) {
+		pullLow(SCL);
+		delayMicroseconds(5);
+		pinMode(SCL, INPUT_PULLUP);
+		releaseScl();
+	}
+	pullLow(SDA);						// STOP: SDA rises while SCL is high
+	delayMicroseconds(5);
+	pinMode(SDA, INPUT_PULLUP);
+	delayMicroseconds(5);
+}
+
+void TwiEngine::pullLow(uint8_t pin)
+{
+	digitalWrite(pin, LOW);				// pull-up off first - never drive the line high
+	pinMode(pin, OUTPUT);
+}
+
+// After SCL is let go, wait for it to rise - a slave may stretch the clock (bounded)
+void TwiEngine::releaseScl(void)
+{
+	for (uint8_t us = 0; (us < TWI_STRETCH_MAX) && !digitalRead(SCL); us += 5)
+		delayMicroseconds(5);
+	delayMicroseconds(5);
+}
+
+// Interrupts off
+void TwiEngine::start(void)
+{
+	TwiXfer *x = _queue[_tail];
+	_startedUs = micros();
+	_index = 0;
+	_reading = (x->txLen == 0) && x->rxLen;		// with neither, just addresses the device (probe)
+	TWCR = TwcrReply | (1 << TWSTA);
+}
+
+// Release the bus, report the outcome & start the next transaction.  Interrupts off.  A STOP
+// that can't complete (a slave holding SCL low) isn't waited for here in the ISR: the bus is
+// left for service() to recover, and the queue waits for it
+void TwiEngine::finish(uint8_t status)
+{
+	if (status != TWI_ARB_LOST) {
+		TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO);
+		uint16_t spins = TWI_STOP_SPINS;
+		while ((TWCR & (1 << TWSTO)) && --spins)
+			;
+		if (!spins) {
+			_stuck = true;
+			status = TWI_BUS_ERROR;
+		}
+	}
+	TwiXfer *x = _queue[_tail];
+	_tail = (_tail + 1) & QueueMask;
+	x->status = status;
+	if (x->callback)
+		x->callback(x);
+	if ((_head != _tail) && !_stuck)
+		start();
+}
+
+void TwiEngine::isr(void)
+{
+	TwiXfer *x = _queue[_tail];
+
+	switch (TW_STATUS) {
+	case TW_START:
+	case TW_REP_START:
+		TWDR = (x->addr << 1) | (_reading ? TW_READ : TW_WRITE);
+		TWCR = TwcrReply;
+		break;
+
+	// master transmitter
+	case TW_MT_SLA_ACK:
+	case TW_MT_DATA_ACK:
+		if (_index < x->txLen) {
+			TWDR = x->tx[_index++];
+			TWCR = TwcrReply;
+		} else if (x->rxLen) {
+			_index = 0;
+			_reading = true;
+			TWCR = TwcrReply | (1 << TWSTA);	// repeated start - keep the bus for the read
+		} else
+			finish(TWI_OK);
+		break;
+	case TW_MT_SLA_NACK:
+	case TW_MR_SLA_NACK:
+		finish(TWI_NACK_ADDR);
+		break;
+	case TW_MT_DATA_NACK:
+		finish(TWI_NACK_DATA);
+		break;
+	case TW_MT_ARB_LOST:				// same code for the receiver
+		TWCR = TwcrReply;				// let the bus go
+		_stuck = true;					// only one master here - noise or a slave upset
+		finish(TWI_ARB_LOST);
+		break;
+
+	// master receiver - ACK every byte but the last
+	case TW_MR_DATA_ACK:
+		x->rx[_index++] = TWDR;
+		// fall through
+	case TW_MR_SLA_ACK:
+		TWCR = TwcrReply | ((_index + 1 < x->rxLen) ? (1 << TWEA) : 0);
+		break;
+	case TW_MR_DATA_NACK:
+		x->rx[_index++] = TWDR;
+		finish(TWI_OK);
+		break;
+
+	default:							// TW_BUS_ERROR - illegal start or stop
+		_stuck = true;
+		finish(TWI_BUS_ERROR);
+		break;
+	}
+}
+
+ISR(TWI_vect)
+{
+	Twi.isr();
+}
+
+TwiEngine Twi;
@@ -0,0 +1,96 @@
+/*
+ * TwiEngine.h - interrupt-driven I2C transactions on the AVR TWI
+ *
+ * Replaces the blocking Wire library.  A transaction (TwiXfer) writes txLen
+ * bytes and then, after a repeated start, reads rxLen bytes - so a register
+ * burst read or write is one transaction.  Transactions are queued and run
+ * from the TWI interrupt one after another; the caller keeps the TwiXfer (and
+ * its buffers) until done() and may ask for a callback, which runs in
+ * interrupt context.  transfer() submits and waits, for drivers with a
+ * synchronous interface.  The wait is bounded: a transaction not finished
+ * within its time on the wire (x4 for clock stretching) plus
+ * TWI_TIMEOUT_MARGIN of starting is abandoned and the bus recovered - SCL is
+ * clocked until a slave holding SDA low lets go, then a STOP is sent.  The
+ * timeout is checked by service(), which transfer() calls while it waits and
+ * a driver polling a background read calls too.
+ * Drivers normally use I2CRegisterDevice.h on top of this.
+ *
+ * The Wire library must not be linked alongside - it claims the same
+ * interrupt vector.
+ */
+
+#ifndef TwiEngine_h
+#define TwiEngine_h
+
+#include <Arduino.h>
+
+#define TWI_QUEUE_SIZE   8				// transactions waiting (power of two)
+#define TWI_STANDARD     100000UL
+#define TWI_FAST         400000UL
+#define TWI_TIMEOUT_MARGIN  1000		// us allowed beyond a transaction's time on the wire
+
+// TwiXfer status
+#define TWI_OK           0
+#define TWI_NACK_ADDR    1				// no device answered
+#define TWI_NACK_DATA    2				// device refused a byte
+#define TWI_ARB_LOST     3
+#define TWI_BUS_ERROR    4				// illegal start/stop, or the STOP hung (bus left to recover)
+#define TWI_QUEUE_FULL   5
+#define TWI_TIMEOUT      6				// no progress - abandoned & the bus recovered
+#define TWI_BUSY         0x80			// queued or in progress
+
+struct TwiXfer;
+typedef void (*TwiCallback)(TwiXfer *x);
+
+struct TwiXfer {
+    uint8_t addr;						// 7 bit address
+    const uint8_t *tx;					// register address, then any data to write
+    uint8_t txLen;
+    uint8_t *rx;
+    uint8_t rxLen;
+    TwiCallback callback;				// optional - called from the TWI ISR when finished
+    void *context;						// for the callback's use
+    volatile uint8_t status;
+
+    void set(uint8_t a, const uint8_t *t, uint8_t tl, uint8_t *r, uint8_t rl)
+        { addr = a; tx = t; txLen = tl; rx = r; rxLen = rl; callback = 0; }
+    bool done(void) const { return !(status & TWI_BUSY); }
+};
+
+class TwiEngine
+{
+  public:
+    TwiEngine();
+    void begin(void);					// idempotent - each driver may call it
+    void setClock(uint32_t hz);			// TWI_STANDARD (default) or TWI_FAST - before or after begin()
+    bool submit(TwiXfer *x);			// false (status TWI_QUEUE_FULL) if the queue is full
+    uint8_t transfer(TwiXfer *x);		// submit & wait (bounded); returns status.  Not with interrupts off
+    void service(void);					// time out the transaction in progress - poll while one is pending
+    unsigned long timeoutUs(const TwiXfer *x) const;	// longest a transaction may take once started
+    bool isIdle(void) const { return _head == _tail; }
+    void isr(void);						// from the TWI ISR only
+
+  private:
+    void start(void);
+    void finish(uint8_t status);
+    void abort(void);
+    void recoverBus(void);				// bit-bang a stuck bus free - from service() only
+    static void pullLow(uint8_t pin);
+    static void releaseScl(void);
+
+    TwiXfer *_queue[TWI_QUEUE_SIZE];
+    volatile uint8_t _head;				// next free slot - written by submit()
+    volatile uint8_t _tail;				// transaction in progress - written by the ISR
+    uint8_t _index;						// byte within tx or rx
+    bool _reading;
+    bool _begun;
+    volatile bool _stuck;				// hung STOP, bus error or lost arbitration - service() recovers
+    volatile bool _recovering;			// service() has the pins - the TWI is off
+    uint32_t _hz;						// SCL rate, applied by begin()
+    uint8_t _bitUs;						// one SCL period
+    unsigned long _startedUs;			// micros() when the transaction in progress started
+};
+
+extern TwiEngine Twi;
+
+#endif
@@ -16,7 +16,8 @@
 #include "cactus_io_BME280_I2C.h"
 
 #include <math.h>
-#include <Wire.h>
+
+#define BME280_DATA_LEN  8                        // pressure, temperature & humidity registers 0xF7-0xFE
 
 /***************************************************************************
  
@@ -24,23 +25,27 @@
  
  ***************************************************************************/
 
-BME280_I2C::BME280_I2C(void)
+BME280_I2C::BME280_I2C(void) : _bus(BME280_ADDRESS)
 {
-    _i2caddr = BME280_ADDRESS;
 
 	tempcal = 0.0;
     temperature = 0.0;
     humidity = 0.0;
     pressure = 0.0;
+    _dataReg = BME280_REGISTER_PRESSUREDATA;
+    _xfer.status = TWI_OK;
+    _rawPending = false;
 }
 
-BME280_I2C::BME280_I2C(uint8_t addr)
+BME280_I2C::BME280_I2C(uint8_t addr) : _bus(addr)
 {
-    _i2caddr = addr;
     tempcal = 0.0;
 	tempcal = 0.0;
     temperature = 0.0;
     humidity = 0.0;
+    _dataReg = BME280_REGISTER_PRESSUREDATA;
+    _xfer.status = TWI_OK;
+    _rawPending = false;
 }
 
 void BME280_I2C::setTempCal(float tcal)
@@ -48,11 +53,38 @@ void BME280_I2C::setTempCal(float tcal)
 	tempcal = tcal;
 }
 
+// All three measurements in one burst, so they come from the same conversion
 void BME280_I2C::readSensor(void)
 {
-    readTemperature();
-    readHumidity();
-    readPressure();
+    uint8_t raw[BME280_DATA_LEN];
+    
+    if (_bus.read(BME280_REGISTER_PRESSUREDATA, raw, BME280_DATA_LEN))
+        compensate(raw);
+}
+
+bool BME280_I2C::requestSensor(void)
+{
+    if (!_xfer.done())
+        return false;
+    
+    _rawPending = _bus.submitRead(_xfer, &_dataReg, _raw, BME280_DATA_LEN);
+    
+    return _rawPending;
+}
+
+bool BME280_I2C::poll(void)
+{
+    if (!_rawPending || !_bus.readDone(_xfer))  // a read on a hung bus times out here
+        return false;
+    
+    _rawPending = false;
+    
+    if (_xfer.status != TWI_OK)
+        return false;                           // keep the last good readings
+    
+    compensate(_raw);
+    
+    return true;
 }
 
 float BME280_I2C::getTemperature_C(void)
@@ -90,7 +122,7 @@ float BME280_I2C::getPressure_HP(void) {
 
 bool BME280_I2C::begin() {
     
-    Wire.begin();
+    Twi.begin();
     
     
     if (read8(BME280_REGISTER_CHIPID) != 0x60)
@@ -99,23 +131,68 @@ bool BME280_I2C::begin() {
     
     readSensorCoefficients();
     
-    // Set Humidity oversampling to 1
-    write8(BME280_REGISTER_CONTROLHUMID, 0x01); // Set before CONTROL (DS 5.4.3)
-    
-    write8(BME280_REGISTER_CONTROL, 0x3F);
+    syncControlRegisters();
     
     return true;
     
 }
 
-void BME280_I2C::readTemperature(void)
+/**************************************************************************
+
+Bring ctrl_hum, ctrl_meas & config to the wanted settings, writing only the
+registers that differ.  A warm restart then leaves a running sensor alone.
+
+**************************************************************************/
+
+void BME280_I2C::syncControlRegisters(void)
 {
     
-    int32_t var1, var2;
+    uint8_t ctrlMeas = read8(BME280_REGISTER_CONTROL);
+    
+    bool humChanged = (read8(BME280_REGISTER_CONTROLHUMID) & 0x07) != BME280_CTRL_HUM_SETTING;
     
-    int32_t adc_T = read24(BME280_REGISTER_TEMPDATA);
+    bool configChanged = (read8(BME280_REGISTER_CONFIG) & 0xFD) != BME280_CONFIG_SETTING;   // bit 1 unused
+    
+    if (configChanged) {
         
-    adc_T >>= 4;
+        // writes to config may be ignored in normal mode, so drop to sleep first (DS 5.4.6)
+        if (ctrlMeas & 0x03) {
+            ctrlMeas &= 0xFC;
+            write8(BME280_REGISTER_CONTROL, ctrlMeas);
+        }
+        write8(BME280_REGISTER_CONFIG, BME280_CONFIG_SETTING);
+    }
+    
+    if (humChanged)
+        write8(BME280_REGISTER_CONTROLHUMID, BME280_CTRL_HUM_SETTING);
+    
+    // ctrl_hum only takes effect after a write to ctrl_meas (DS 5.4.3)
+    if (humChanged || (ctrlMeas != BME280_CTRL_MEAS_SETTING))
+        write8(BME280_REGISTER_CONTROL, BME280_CTRL_MEAS_SETTING);
+    
+}
+
+void BME280_I2C::compensate(const uint8_t *raw)
+{
+    
+    int32_t adc_P = ((uint32_t)raw[0] << 12) | ((uint32_t)raw[1] << 4) | (raw[2] >> 4);
+    
+    int32_t adc_T = ((uint32_t)raw[3] << 12) | ((uint32_t)raw[4] << 4) | (raw[5] >> 4);
+    
+    int32_t adc_H = ((uint32_t)raw[6] << 8) | raw[7];
+    
+    readTemperature(adc_T);                     // sets t_fine for the other two
+    
+    readHumidity(adc_H);
+    
+    readPressure(adc_P);
+    
+}
+
+void BME280_I2C::readTemperature(int32_t adc_T)
+{
+    
+    int32_t var1, var2;
     
     var1  = ((((adc_T>>3) - ((int32_t)cal_data.dig_T1 <<1))) *
              
@@ -137,13 +214,10 @@ void BME280_I2C::readTemperature(void)
 }
 
 
-void BME280_I2C::readPressure(void) {
+void BME280_I2C::readPressure(int32_t adc_P) {
     
     int64_t var1, var2, p;
     
-    int32_t adc_P = read24(BME280_REGISTER_PRESSUREDATA);    
-    adc_P >>= 4;
-    
     var1 = ((int64_t)t_fine) - 128000;
     
     var2 = var1 * var1 * (int64_t)cal_data.dig_P6;
@@ -181,9 +255,7 @@ void BME280_I2C::readPressure(void) {
 }
 
 
-void BME280_I2C::readHumidity(void) {
-    
-    int32_t adc_H = read16(BME280_REGISTER_HUMIDDATA);
+void BME280_I2C::readHumidity(int32_t adc_H) {
     
     int32_t v_x1_u32r;
     
@@ -225,41 +297,49 @@ Read the values that are programmed into the sensor during amanufacture
 void BME280_I2C::readSensorCoefficients(void)
 {
     
-    cal_data.dig_T1 = read16_LE(BME280_DIG_T1_REG);
+    uint8_t tp[24];                             // 0x88-0x9F: dig_T1 - dig_P9, little endian
+    
+    uint8_t h[7];                               // 0xE1-0xE7: dig_H2 - dig_H6
+    
+    _bus.read(BME280_DIG_T1_REG, tp, sizeof(tp));
     
-    cal_data.dig_T2 = readS16_LE(BME280_DIG_T2_REG);
+    _bus.read(BME280_DIG_H2_REG, h, sizeof(h));
     
-    cal_data.dig_T3 = readS16_LE(BME280_DIG_T3_REG);
+    cal_data.dig_T1 = tp[0] | (tp[1] << 8);
     
-    cal_data.dig_P1 = read16_LE(BME280_DIG_P1_REG);
+    cal_data.dig_T2 = (int16_t)(tp[2] | (tp[3] << 8));
     
-    cal_data.dig_P2 = readS16_LE(BME280_DIG_P2_REG);
+    cal_data.dig_T3 = (int16_t)(tp[4] | (tp[5] << 8));
     
-    cal_data.dig_P3 = readS16_LE(BME280_DIG_P3_REG);
+    cal_data.dig_P1 = tp[6] | (tp[7] << 8);
     
-    cal_data.dig_P4 = readS16_LE(BME280_DIG_P4_REG);
+    cal_data.dig_P2 = (int16_t)(tp[8] | (tp[9] << 8));
     
-    cal_data.dig_P5 = readS16_LE(BME280_DIG_P5_REG);
+    cal_data.dig_P3 = (int16_t)(tp[10] | (tp[11] << 8));
     
-    cal_data.dig_P6 = readS16_LE(BME280_DIG_P6_REG);
+    cal_data.dig_P4 = (int16_t)(tp[12] | (tp[13] << 8));
     
-    cal_data.dig_P7 = readS16_LE(BME280_DIG_P7_REG);
+    cal_data.dig_P5 = (int16_t)(tp[14] | (tp[15] << 8));
     
-    cal_data.dig_P8 = readS16_LE(BME280_DIG_P8_REG);
+    cal_data.dig_P6 = (int16_t)(tp[16] | (tp[17] << 8));
     
-    cal_data.dig_P9 = readS16_LE(BME280_DIG_P9_REG);
+    cal_data.dig_P7 = (int16_t)(tp[18] | (tp[19] << 8));
+    
+    cal_data.dig_P8 = (int16_t)(tp[20] | (tp[21] << 8));
+    
+    cal_data.dig_P9 = (int16_t)(tp[22] | (tp[23] << 8));
     
     cal_data.dig_H1 = read8(BME280_DIG_H1_REG);
     
-    cal_data.dig_H2 = readS16_LE(BME280_DIG_H2_REG);
+    cal_data.dig_H2 = (int16_t)(h[0] | (h[1] << 8));
     
-    cal_data.dig_H3 = read8(BME280_DIG_H3_REG);
+    cal_data.dig_H3 = h[2];
     
-    cal_data.dig_H4 = (read8(BME280_DIG_H4_REG) << 4) | (read8(BME280_DIG_H4_REG+1) & 0xF);
+    cal_data.dig_H4 = (h[3] << 4) | (h[4] & 0xF);
     
-    cal_data.dig_H5 = (read8(BME280_DIG_H5_REG+1) << 4) | (read8(BME280_DIG_H5_REG) >> 4);
+    cal_data.dig_H5 = (h[5] << 4) | (h[4] >> 4);
     
-    cal_data.dig_H6 = (int8_t)read8(BME280_DIG_H6_REG);
+    cal_data.dig_H6 = (int8_t)h[6];
     
 }
 
@@ -267,20 +347,15 @@ void BME280_I2C::readSensorCoefficients(void)
 
 /**************************************************************************
 
-Writes an 8 bit value over I2C
+Writes an 8 bit value over I2C.  Register access goes through I2CDevice,
+so each call is bounded in time and retried; reads that fail return zeros
 
 **************************************************************************/
 
 void BME280_I2C::write8(byte reg, byte value)
 {
     
-    Wire.beginTransmission((uint8_t)_i2caddr);
-    
-    Wire.write((uint8_t)reg);
-    
-    Wire.write((uint8_t)value);
-    
-    Wire.endTransmission();
+    _bus.write8(reg, value);
     
 }
 
@@ -293,19 +368,7 @@ void BME280_I2C::write8(byte reg, byte value)
 uint8_t BME280_I2C::read8(byte reg)
 {
     
-    uint8_t value;
-    
-    Wire.beginTransmission((uint8_t)_i2caddr);
-    
-    Wire.write((uint8_t)reg);
-    
-    Wire.endTransmission();
-    
-    Wire.requestFrom((uint8_t)_i2caddr, (byte)1);
-    
-    value = Wire.read();
-    
-    return value;
+    return _bus.read8(reg);
     
 }
 
@@ -329,19 +392,11 @@ int16_t BME280_I2C::readS16_LE(byte reg)
 uint16_t BME280_I2C::read16(byte reg)
 {
     
-    uint16_t value;
-    
-    Wire.beginTransmission((uint8_t)_i2caddr);
-    
-    Wire.write((uint8_t)reg);
-    
-    Wire.endTransmission();
+    uint8_t buf[2];
     
-    Wire.requestFrom((uint8_t)_i2caddr, (byte)2);
+    _bus.read(reg, buf, 2);
     
-    value = (Wire.read() << 8) | Wire.read();
-        
-    return value;
+    return (buf[0] << 8) | buf[1];
     
 }
 
@@ -361,31 +416,10 @@ Reads a signed 24 bit value over the I2C bus_REG
 uint32_t BME280_I2C::read24(byte reg)
 {
     
-    uint32_t value;
-    
-    Wire.beginTransmission((uint8_t)_i2caddr);
+    uint8_t buf[3];
     
-    Wire.write((uint8_t)reg);
+    _bus.read(reg, buf, 3);
     
-    Wire.endTransmission();
-    
-    Wire.requestFrom((uint8_t)_i2caddr, (byte)3);
-
-    value = Wire.read();
-    
-	value <<= 8;
-
-	value |= Wire.read();
-
-	value <<= 8;
-
-	value |= Wire.read();
-    
-    return value;
+    return ((uint32_t)buf[0] << 16) | ((uint32_t)buf[1] << 8) | buf[2];
     
 }
-
-
-
-
-
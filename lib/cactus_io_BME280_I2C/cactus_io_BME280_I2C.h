@@ -14,6 +14,7 @@
 #define __BME280_I2C_H__
 
 #include "Arduino.h"
+#include <I2CRegisterDevice.h>
 
 #define BME280_ADDRESS      0x77          // define the default I2C address
 
@@ -52,6 +53,12 @@
 #define    BME280_REGISTER_TEMPDATA         0xFA
 #define    BME280_REGISTER_HUMIDDATA        0xFD
 
+// Control register settings applied by begin()  (DS 5.4.3 - 5.4.6)
+
+#define    BME280_CTRL_HUM_SETTING      0x01      // humidity oversampling x1
+#define    BME280_CTRL_MEAS_SETTING     0x3F      // temp x1, pressure x16, normal mode
+#define    BME280_CONFIG_SETTING        0x00      // 0.5ms standby, filter off, no 3-wire SPI
+
 
 // structure to hold the calibration data that is programmed into the sensor in the factory
 // during manufacture
@@ -107,6 +114,9 @@ public:
 
     void readSensor(void);                      // read the sensor for data
     
+    bool requestSensor(void);                   // start a read in the background (TwiEngine) - false if one is running
+    bool poll(void);                            // true once, when the background read has been taken up
+    
     float getTemperature_C(void);
     float getTemperature_F(void);
     float getHumidity(void);
@@ -118,10 +128,12 @@ private:
     
     BME280_Calibration_Data cal_data;			// holds all of the sensor calibration data
     
-    void readTemperature(void);
-	void readPressure(void);
-    void readHumidity(void);
+    void compensate(const uint8_t *raw);        // from the 8 data registers, pressure MSB first
+    void readTemperature(int32_t adc_T);
+	void readPressure(int32_t adc_P);
+    void readHumidity(int32_t adc_H);
     void readSensorCoefficients(void);
+    void syncControlRegisters(void);
     
 	float    tempcal;							// stores the temp offset calibration
     float    temperature;                       // stores temperature value
@@ -138,7 +150,12 @@ private:
     int16_t   readS16(byte reg);
     uint16_t  read16_LE(byte reg); // little endian
     int16_t   readS16_LE(byte reg); // little endian
-    uint8_t   _i2caddr;
+    
+    TwiXfer   _xfer;                            // background read of the data registers
+    uint8_t   _dataReg;
+    uint8_t   _raw[8];
+    bool      _rawPending;
+    I2CDevice _bus;                             // address chosen at runtime, so not I2CRegisterDevice<>
     int32_t   _sensorID;
     int32_t   t_fine;
 
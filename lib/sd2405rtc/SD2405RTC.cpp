@@ -25,14 +25,28 @@
  */
 
 #include "Arduino.h"
-#include <Wire.h>
+#include <I2CRegisterDevice.h>
 #include "SD2405RTC.h"
 
 #define SD2405_ADDR 0x32
+#define FREQINT_CTR2 0b10101001		// 10H setting for a Frequency Interrupt on INT
+#define REG_COUNT  0x20				// registers 00H-1FH
+#define REG_WINDOW 8				// registers per burst in readRegisters()
+
+// Tens value of the upper BCD nibble
+static const uint8_t bcdTens[16] PROGMEM = { 0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120, 130, 140, 150 };
+
+// Bounded, retried register access - a hung bus can't stall a clock read
+static I2CRegisterDevice<SD2405_ADDR> rtcBus;
 
 SD2405RTC::SD2405RTC()
 {
-  Wire.begin();
+}
+
+// Not done by the constructor - it may run before TwiEngine's (global constructor order)
+void SD2405RTC::begin()
+{
+  Twi.begin();
 }
   
 // PUBLIC FUNCTIONS
@@ -40,7 +54,8 @@ SD2405RTC::SD2405RTC()
 time_t SD2405RTC::get()   // Aquire data from buffer and convert to time_t
 {
   tmElements_t tm;
-  read(tm);
+  if (!read(tm))
+    return 0;                   // 0 tells TimeLib the sync failed
   return(makeTime(tm));
 }
 
@@ -51,26 +66,17 @@ void  SD2405RTC::set(time_t t)
   write(tm); 
 }
 
-// Aquire datetime data from the RTC chip in BCD format
-void SD2405RTC::read( tmElements_t &tm)
+// Aquire datetime data (00H-06H) from the RTC chip in BCD format
+bool SD2405RTC::read( tmElements_t &tm)
 {
   unsigned char date[7];
-  unsigned char n=0;
   unsigned char i;
  
-  Wire.requestFrom(SD2405_ADDR,tmNbrFields);
-  while(Wire.available())
-  {  
-    date[n++]=Wire.read();
-  }
-  delayMicroseconds(1);
-  Wire.endTransmission();
+  if (!rtcBus.read(0x00, date, 7))
+    return false;                           // leave tm untouched if the chip did not answer
+  date[2] &= 0x7f;                          // clear the hour's highest bit 12_/24 ; 0x7F is bcd 0111-1111
   for(i=0;i<7;i++)
   {
-    if(i==2) {
-      date[i]=(date[i]&0x7f); //clear the hour's highest bit 12_/24 ; 0x7F is bcd 0111-1111
-    }
-    //date[i]=(((date[i]&0xf0)>>4)*10)+(date[i]&0x0f); // ; 0xF0 is bcd 1111-0000 ; 0x0f is bcd 0000-1111
     date[i]=bcd2dec(date[i]);
   }
   tm.Second = date[0];
@@ -81,126 +87,128 @@ void SD2405RTC::read( tmElements_t &tm)
   tm.Month = date[5];
   //tm.Year = date[6];            // Number of years since 2K
   tm.Year = y2kYearToTm(date[6]); // We add 30 years to get time from 1970
+  return true;
 }
 
 // Write datetime data to the RTC chip in BCD format
 void SD2405RTC::write(tmElements_t &tm)
 {
+  uint8_t date[7];
+  date[0] = dec2bcd(tm.Second);
+  date[1] = dec2bcd(tm.Minute);
+  date[2] = dec2bcd(tm.Hour+80);        // +80: sets 24 hours format
+  date[3] = dec2bcd(tm.Wday-1);         // days values come from 0 to 6: Sunday, Monday, Tuesday, Wednesday, Thursday, Friday, Saturday
+  date[4] = dec2bcd(tm.Day);
+  date[5] = dec2bcd(tm.Month);
+  date[6] = dec2bcd(tm.Year);
+  uint8_t trim = 0;                     // Counts will not change when (F6, F5, F4, F3, F2, F1, F0) are set to (*, 0, 0, 0, 0, 0, *).
   enableWrite();
-  Wire.beginTransmission(SD2405_ADDR);
-  Wire.write(byte(0));                  // reset register pointer  
-  Wire.write(dec2bcd(tm.Second)) ;   
-  Wire.write(dec2bcd(tm.Minute));
-  Wire.write(dec2bcd(tm.Hour+80));      // +80: sets 24 hours format
-  Wire.write(dec2bcd(tm.Wday-1));       // days values come from 0 to 6: Sunday, Monday, Tuesday, Wednesday, Thursday, Friday, Saturday
-  Wire.write(dec2bcd(tm.Day));
-  Wire.write(dec2bcd(tm.Month));
-  Wire.write(dec2bcd(tm.Year));
-  Wire.endTransmission();
-  Wire.beginTransmission(SD2405_ADDR);
-  Wire.write(0x12);                     // set the address for writing as 12H : Time Trimming Register
-  Wire.write(byte(0));                  // Counts will not change when (F6, F5, F4, F3, F2, F1, F0) are set to (*, 0, 0, 0, 0, 0, *).
-  Wire.endTransmission();
+  rtcBus.write(0x00, date, 7);
+  rtcBus.write(0x12, &trim, 1);         // 12H : Time Trimming Register
   disableWrite(false);
 }
 
-// Aquire alarm data from the RTC chip in BCD format
+// Aquire alarm data (07H-0DH) from the RTC chip in BCD format
 void SD2405RTC::readAlarm( tmElements_t &al)
 {
   
-  unsigned char alarm[20];
-  unsigned char n=0;
+  unsigned char alarm[7];
   unsigned char i;
  
-  Wire.requestFrom(SD2405_ADDR,20);
-  while(Wire.available())
-  {
-    alarm[n++]=Wire.read();
-  }
-  delayMicroseconds(1);
-  Wire.endTransmission();
+  if (!rtcBus.read(0x07, alarm, 7))
+    return;
   
-  for(i=0;i<20;i++)
+  for(i=0;i<7;i++)
   {
     alarm[i]=bcd2dec(alarm[i]);
   }
   
-  al.Second = alarm[7];
-  al.Minute = alarm[8];
-  al.Hour = alarm[9];
-  al.Wday = alarm[10];
-  al.Day = alarm[11];
-  al.Month = alarm[12];
-  al.Year = y2kYearToTm(alarm[13]);
+  al.Second = alarm[0];
+  al.Minute = alarm[1];
+  al.Hour = alarm[2];
+  al.Wday = alarm[3];
+  al.Day = alarm[4];
+  al.Month = alarm[5];
+  al.Year = y2kYearToTm(alarm[6]);
 }
 
 // Write alarm data to the RTC chip in BCD format
 void SD2405RTC::writeAlarm(tmElements_t &al, boolean periodic, boolean dateAlarm)
 {
-  enableWrite();
-  Wire.beginTransmission(SD2405_ADDR);
-  Wire.write(0x07);                // Set the address for writing as 07H
-  Wire.write(dec2bcd(al.Second));  // 07H Alarm Second
-  Wire.write(dec2bcd(al.Minute));  // 08H Alarm Minute
-  Wire.write(dec2bcd(al.Hour));    // 09H Alarm Hour
+  uint8_t reg[10];                 // 07H - 10H
+  reg[0] = dec2bcd(al.Second);     // 07H Alarm Second
+  reg[1] = dec2bcd(al.Minute);     // 08H Alarm Minute
+  reg[2] = dec2bcd(al.Hour);       // 09H Alarm Hour
   if (dateAlarm) {
-    Wire.write(0b00000000);        // 0AH Alarm Week : This is not the name of the day, but the days the alarm will be enabled ;
-    Wire.write(dec2bcd(al.Day));   // 0BH Alarm Day
-    Wire.write(dec2bcd(al.Month)); // 0CH Alarm Month
-    Wire.write(dec2bcd(al.Year));  // 0DH Alarm Year
-    Wire.write(0b01110111);        // 0EH Disable Week Alarm ; Alarm will be on when reaching the defined date.
+    reg[3] = 0b00000000;           // 0AH Alarm Week : This is not the name of the day, but the days the alarm will be enabled ;
+    reg[4] = dec2bcd(al.Day);      // 0BH Alarm Day
+    reg[5] = dec2bcd(al.Month);    // 0CH Alarm Month
+    reg[6] = dec2bcd(al.Year);     // 0DH Alarm Year
+    reg[7] = 0b01110111;           // 0EH Disable Week Alarm ; Alarm will be on when reaching the defined date.
   } else {
-    Wire.write(al.Wday);           // 0AH Alarm Week : This is not the name of the day, but the days the alarm will be enabled ; 0b01111111 : Each days of the week
-    Wire.write(0b00000000);        // When the week alarm and the date alarm are
-    Wire.write(0b00000000);        // both enable at the same time, only the date
-    Wire.write(0b00000000);        // alarm is valid and the week alarm is invalid.
-    Wire.write(0b00001111);        // 0EH Enable Alarm: Week / Hour / Minute / Second ; This is the week alarm: it will be enable on some days at a defined time ; 0EH=0b00001111
+    reg[3] = al.Wday;              // 0AH Alarm Week : This is not the name of the day, but the days the alarm will be enabled ; 0b01111111 : Each days of the week
+    reg[4] = 0b00000000;           // When the week alarm and the date alarm are
+    reg[5] = 0b00000000;           // both enable at the same time, only the date
+    reg[6] = 0b00000000;           // alarm is valid and the week alarm is invalid.
+    reg[7] = 0b00001111;           // 0EH Enable Alarm: Week / Hour / Minute / Second ; This is the week alarm: it will be enable on some days at a defined time ; 0EH=0b00001111
   }
-  Wire.write(0b10000100);          // 0FH WRTC3=1 0 INTAF=0 INTDF=0 0 WRTC2=1 0 RTCF=0
+  reg[8] = 0b10000100;             // 0FH WRTC3=1 0 INTAF=0 INTDF=0 0 WRTC2=1 0 RTCF=0
+  byte ctr2;
   if (periodic) {                  // If IM=0 this is a single event
-    Wire.write(0b11010010);        // 10H WRTC1=1 IM=1 INTS1=0 INTS0=1 FOBAT=0 INTDE=0 INTAE=1 INTFE=0
+    ctr2 = 0b11010010;             // 10H WRTC1=1 IM=1 INTS1=0 INTS0=1 FOBAT=0 INTDE=0 INTAE=1 INTFE=0
   } else {                         // If IM=1 this is a periodic event
-    Wire.write(0b10010010);        // 10H WRTC1=1 IM=0 INTS1=0 INTS0=1 FOBAT=0 INTDE=0 INTAE=1 INTFE=0
+    ctr2 = 0b10010010;             // 10H WRTC1=1 IM=0 INTS1=0 INTS0=1 FOBAT=0 INTDE=0 INTAE=1 INTFE=0
   }
-  Wire.endTransmission();
+  reg[9] = ctr2;
+  enableWrite();
+  rtcBus.write(0x07, reg, 10);
   
-  disableWrite(true);
+  disableWrite(true, ctr2);        // keep the alarm interrupt enabled when WRTC1 is cleared
   al.Year = y2kYearToTm(al.Year);
 }
 
 // Write interrupt control register for Frequency Interrupt
 void SD2405RTC::writeFreqInt(byte frequency)
 {
+	uint8_t ctr[2];
+	ctr[0] = FREQINT_CTR2;			// 10H WRTC1=1 IM=0 INTS1=1 INTS0=0 FOBAT=1 INTDE=0 INTAE=0 INTFE=1
+	ctr[1] = 0x0F & frequency; 		// 11H Set low-order bits FS3,FS2,FS1,FS0 to frequency selection
 	enableWrite();
-	Wire.beginTransmission(SD2405_ADDR);
-	Wire.write(0x10);				// Set the address for writing as 10H
-	Wire.write(0b10101001);			// 10H WRTC1=1 IM=0 INTS1=1 INTS0=0 FOBAT=1 INTDE=0 INTAE=0 INTFE=1
-	Wire.write(0x0F & frequency); 	// 11H Set low-order bits FS3,FS2,FS1,FS0 to frequency selection
-	Wire.endTransmission();
-	disableWrite(true);
+	rtcBus.write(0x10, ctr, 2);
+	disableWrite(true, FREQINT_CTR2);	// keep the interrupt selection when WRTC1 is cleared
+}
+
+// Program the Frequency Interrupt only if the chip is not already set up that way.
+// Returns true if the registers had to be written.
+boolean SD2405RTC::syncFreqInt(byte frequency)
+{
+	byte ctr[2];					// 10H (WRTC1 reads back as 0 once writing is disabled), 11H
+	if (rtcBus.read(0x10, ctr, 2)) {
+		if (((ctr[0] & 0x7F) == (FREQINT_CTR2 & 0x7F)) && ((ctr[1] & 0x0F) == (0x0F & frequency)))
+			return false;
+	}
+	writeFreqInt(frequency);
+	return true;
 }
 	
 
 // Print the RTC registers values in differents formats (for debugging purpose).
+//  Registers are fetched REG_WINDOW at a time so stack use does not depend on nb
 void SD2405RTC::readRegisters(int nb)
 {
-  unsigned char data[nb];
-  unsigned char n=0;
+  unsigned char data[REG_WINDOW];
   unsigned char i;
  
-  Wire.requestFrom(SD2405_ADDR,nb);
-  while(Wire.available())
-  {
-    data[n++]=Wire.read();
-  }
-  delayMicroseconds(1);
-  Wire.endTransmission();
+  if (nb > REG_COUNT) nb = REG_COUNT;
   Serial.println("RTC Registers Values: ");
   Serial.println("-------------------------");
   Serial.println("Add.\tB2D \tDEC \tBIN");
   Serial.println("-------------------------");
   for(i=0;i<nb;i++)
   {
+    if ((i % REG_WINDOW) == 0) {
+      rtcBus.read(i, data, min(nb - i, REG_WINDOW));
+    }
     if ((i==7)|(i==15)|(i==20)) {
       Serial.println("-------------------------");
     }
@@ -211,17 +219,18 @@ void SD2405RTC::readRegisters(int nb)
     Serial.print(i, HEX);
     Serial.print("H \t");
     //Serial.print(data[i]);
-    if (bcd2dec(data[i])<10) {
+    byte value = data[i % REG_WINDOW];
+    if (bcd2dec(value)<10) {
       Serial.print("  ");
-    } else if (bcd2dec(data[i])<100) {
+    } else if (bcd2dec(value)<100) {
       Serial.print(" ");
     }
-    Serial.print(bcd2dec(data[i]));
+    Serial.print(bcd2dec(value));
     Serial.print(" \t");
-    Serial.print(data[i]);
+    Serial.print(value);
     Serial.print(" \t");
     for (unsigned int mask = 0x80; mask; mask >>= 1) {
-      Serial.print(mask&data[i]?'1':'0');
+      Serial.print(mask&value?'1':'0');
     }
     Serial.println("B");
   }
@@ -239,36 +248,30 @@ uint8_t SD2405RTC::dec2bcd(uint8_t num)
 // Convert Binary Coded Decimal (BCD) to Decimal
 uint8_t SD2405RTC::bcd2dec(uint8_t num)
 {
-  return ((num/16 * 10) + (num % 16));
+  return pgm_read_byte(&bcdTens[num >> 4]) + (num & 0x0F);
 }
 
 //Enable writing to SD2405
 void SD2405RTC::enableWrite(void)
 {
-  Wire.beginTransmission(SD2405_ADDR);
-  Wire.write(0x10);       // Set the address for writing as 10H
-  Wire.write(0x80);       // Set WRTC1=1
-  Wire.endTransmission();
-  
-  Wire.beginTransmission(SD2405_ADDR);    
-  Wire.write(0x0F);       // Set the address for writing as OFH
-  Wire.write(0x84);       // Set WRTC2=1,WRTC3=1      
-  Wire.endTransmission();
+  uint8_t wrtc1 = 0x80;   // 10H WRTC1=1
+  uint8_t wrtc23 = 0x84;  // 0FH WRTC2=1,WRTC3=1
+  rtcBus.write(0x10, &wrtc1, 1);
+  rtcBus.write(0x0F, &wrtc23, 1);
 }
 
 //Disable writing to SD2405
-void SD2405RTC::disableWrite(boolean alarm)
+//  ctr2 is the interrupt setting to leave in 10H alongside WRTC1=0
+void SD2405RTC::disableWrite(boolean alarm, byte ctr2)
 {
-  Wire.beginTransmission(SD2405_ADDR);   
-  Wire.write(0x0F);       // Set the address for writing as OFH          
-  Wire.write(byte(0));    // Set WRTC2=0,WRTC3=0
+  uint8_t ctr[2];
+  ctr[0] = 0;             // 0FH WRTC2=0,WRTC3=0
+  ctr[1] = ctr2 & 0x7F;   // 10H WRTC1=0
   if (alarm) {
-    Wire.endTransmission();
-    Wire.beginTransmission(SD2405_ADDR);
-    Wire.write(0x10);     // Set the address for writing as 10H
-  }
-  Wire.write(byte(0));    // Set WRTC1=0  
-  Wire.endTransmission();
+    rtcBus.write(0x0F, ctr, 1);
+    rtcBus.write(0x10, &ctr[1], 1);
+  } else
+    rtcBus.write(0x0F, ctr, 2);
 }
 
 //Enable Alarm Interrupt
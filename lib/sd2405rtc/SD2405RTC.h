@@ -29,26 +29,39 @@
 
 #include <Time.h>
 
+// Frequency interrupt selections for writeFreqInt() - FS3..FS0 of register 11H
+#define SD2405_FREQ_4096HZ  0x02
+#define SD2405_FREQ_1024HZ  0x03
+#define SD2405_FREQ_64HZ    0x04
+#define SD2405_FREQ_32HZ    0x05
+#define SD2405_FREQ_16HZ    0x06
+#define SD2405_FREQ_8HZ     0x07
+#define SD2405_FREQ_4HZ     0x08
+#define SD2405_FREQ_2HZ     0x09
+#define SD2405_FREQ_1HZ     0x0A
+
 // library interface description
 class SD2405RTC
 {
   // user-accessible "public" interface
   public:
     SD2405RTC();
+    static void begin();                  // start the I2C bus - before any other call
     static time_t get();
     static void set(time_t t);
-    static void read(tmElements_t &tm);
+    static bool read(tmElements_t &tm);
     static void write(tmElements_t &tm);
     static void readAlarm(tmElements_t &al);
     static void writeAlarm(tmElements_t &al, boolean periodic, boolean dateAlarm);
     static void readRegisters(int nb);
 	static void writeFreqInt(byte frequency);
+	static boolean syncFreqInt(byte frequency);
 
   private:
     static uint8_t dec2bcd(uint8_t num);
     static uint8_t bcd2dec(uint8_t num);
     static void enableWrite(void);
-    static void disableWrite(boolean alarm);
+    static void disableWrite(boolean alarm, byte ctr2 = 0);
     static void enableAlarm(void);
     static void disableAlarm(void);
 };
@@ -0,0 +1,37 @@
+/*
+ * BootProfile.cpp - timestamps of the setup() stages, from reset to first sample
+ */
+
+#include "BootProfile.h"
+
+BootProfile::BootProfile()
+{
+	_count = 0;
+	_printed = false;
+}
+
+void BootProfile::mark(const __FlashStringHelper *stage)
+{
+	if (_count >= BOOT_STAGES_MAX)
+		return;
+	_atUs[_count] = micros();
+	_stage[_count++] = stage;
+}
+
+void BootProfile::print(void)
+{
+	if (_printed)
+		return;
+	Serial.println(F("Boot profile (ms since reset / in stage):"));
+	unsigned long prev = 0;
+	for (uint8_t i = 0; i < _count; i++) {
+		Serial.print(F("  "));
+		Serial.print(_stage[i]);
+		Serial.print(F(": "));
+		Serial.print(_atUs[i] / 1000.0, 1);
+		Serial.print(F(" / "));
+		Serial.println((_atUs[i] - prev) / 1000.0, 1);
+		prev = _atUs[i];
+	}
+	_printed = true;
+}
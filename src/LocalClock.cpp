@@ -0,0 +1,66 @@
+/*
+ * LocalClock.cpp - incremental UTC to local time conversion
+ */
+
+#include "LocalClock.h"
+
+#define SECS_PER_WEEK_  (7UL * SECS_PER_DAY)
+#define SEARCH_WEEKS    60				// > 1 year: a zone without DST just re-checks yearly
+
+LocalClock::LocalClock(Timezone &tz) : _tz(tz)
+{
+	_offset = 0;
+	_validFrom = 1;
+	_nextChange = 0;					// forces a refresh on first use
+}
+
+time_t LocalClock::toLocal(time_t utc)
+{
+	if ((utc >= _nextChange) || (utc < _validFrom))
+		refresh(utc);
+	return utc + _offset;
+}
+
+// Only called once per boundary, so the Timezone conversion back to UTC is affordable here
+// and stays correct when a DST change falls between now and the boundary
+time_t LocalClock::nextLocalHour(time_t utc, uint8_t hr)
+{
+	time_t local = toLocal(utc);
+	time_t boundary = previousMidnight(local) + hr * SECS_PER_HOUR;
+	if (boundary <= local)
+		boundary += SECS_PER_DAY;
+	return _tz.toUTC(boundary);
+}
+
+// Find the offset in force at utc, then the next change: step forward a week at a time
+// until the DST state flips, and bisect that week down to the second
+void LocalClock::refresh(time_t utc)
+{
+	TimeChangeRule *tcr;
+	_tz.toLocal(utc, &tcr);
+	_offset = tcr->offset * 60L;
+	_validFrom = utc;
+
+	bool dst = _tz.utcIsDST(utc);
+	time_t lo = utc;
+	time_t hi = utc;
+	uint8_t week;
+	for (week = 0; week < SEARCH_WEEKS; week++) {
+		hi = lo + SECS_PER_WEEK_;
+		if (_tz.utcIsDST(hi) != dst)
+			break;
+		lo = hi;
+	}
+	if (week == SEARCH_WEEKS) {
+		_nextChange = hi;
+		return;
+	}
+	while (hi - lo > 1) {
+		time_t mid = lo + (hi - lo) / 2;
+		if (_tz.utcIsDST(mid) == dst)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	_nextChange = hi;
+}
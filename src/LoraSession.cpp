@@ -0,0 +1,114 @@
+/*
+ * LoraSession.cpp - OTAA session kept in EEPROM across resets
+ */
+
+#include <EEPROM.h>
+#include <util/crc16.h>
+#include "LoraSession.h"
+#include "EepromMap.h"
+
+static_assert(sizeof(LMIC.channelMap) <= SESSION_CHANNEL_MAP, "LoraSession channel mask too small for this region");
+static_assert(SESSION_CHANNELS <= SESSION_CHANNEL_MAP * 8, "SESSION_CHANNELS beyond the saved mask");
+
+LoraSession::LoraSession(const uint8_t *appEui, const uint8_t *devEui, const uint8_t *appKey)
+{
+	_appEui = appEui;
+	_devEui = devEui;
+	_appKey = appKey;
+	_savedSeqnoUp = 0;
+	_valid = false;
+}
+
+uint16_t LoraSession::credentialCrc(void) const
+{
+	uint16_t c = 0xFFFF;
+	for (uint8_t i = 0; i < 8; i++)
+		c = _crc16_update(c, pgm_read_byte(&_appEui[i]));
+	for (uint8_t i = 0; i < 8; i++)
+		c = _crc16_update(c, pgm_read_byte(&_devEui[i]));
+	for (uint8_t i = 0; i < 16; i++)
+		c = _crc16_update(c, pgm_read_byte(&_appKey[i]));
+	return c;
+}
+
+uint16_t LoraSession::crc(const Session &s)
+{
+	const uint8_t *p = (const uint8_t *)&s;
+	uint16_t c = 0xFFFF;
+	for (uint8_t i = 0; i < offsetof(Session, crc); i++)
+		c = _crc16_update(c, p[i]);
+	return c;
+}
+
+bool LoraSession::restore(void)
+{
+	Session s;
+	EEPROM.get(EEPROM_LORA_SESSION, s);
+	if ((s.version != SESSION_VERSION) || (s.crc != crc(s)) || (s.credentials != credentialCrc()))
+		return false;
+
+	LMIC_setSession(s.netid, s.devaddr, s.nwkSKey, s.appSKey);
+	LMIC.seqnoUp = s.seqnoUp + SESSION_FCNT_STEP;	// skip any counters used since the last write
+	LMIC.seqnoDn = s.seqnoDn;
+	restoreChannels(s.channelMap);
+	LMIC.rx1DrOffset = s.rx1DrOffset;
+	LMIC.rxDelay = s.rxDelay;
+	LMIC.dn2Dr = s.dn2Dr;
+	LMIC_setDrTxpow(s.datarate, 14);
+	_valid = true;
+	write();							// so a reset loop can't hand out the same counters again
+	return true;
+}
+
+// Channel by channel through LMIC, not straight into LMIC.channelMap, so its counts of
+// active 125kHz & 500kHz channels (used to pick the next channel) agree with the mask
+void LoraSession::restoreChannels(const uint8_t *map)
+{
+	for (uint8_t ch = 0; ch < SESSION_CHANNELS; ch++) {
+		if (map[ch / 8] & (1 << (ch % 8)))
+			LMIC_enableChannel(ch);
+		else
+			LMIC_disableChannel(ch);
+	}
+}
+
+void LoraSession::save(void)
+{
+	_valid = true;
+	write();
+}
+
+// The session keys don't change between joins, so EEPROM.put() normally only rewrites the
+// counter & CRC bytes
+void LoraSession::write(void)
+{
+	Session s;
+	memset(&s, 0, sizeof(s));
+	s.version = SESSION_VERSION;
+	s.credentials = credentialCrc();
+	LMIC_getSessionKeys(&s.netid, &s.devaddr, s.nwkSKey, s.appSKey);
+	s.seqnoUp = LMIC.seqnoUp;
+	s.seqnoDn = LMIC.seqnoDn;
+	memcpy(s.channelMap, LMIC.channelMap, sizeof(LMIC.channelMap));
+	s.datarate = LMIC.datarate;
+	s.rx1DrOffset = LMIC.rx1DrOffset;
+	s.rxDelay = LMIC.rxDelay;
+	s.dn2Dr = LMIC.dn2Dr;
+	s.crc = crc(s);
+	EEPROM.put(EEPROM_LORA_SESSION, s);
+	_savedSeqnoUp = s.seqnoUp;
+}
+
+// Until the next write the counter can run at most SESSION_FCNT_STEP past the saved value,
+// which is exactly what restore() skips over
+void LoraSession::checkpoint(void)
+{
+	if (_valid && (LMIC.seqnoUp - _savedSeqnoUp >= SESSION_FCNT_STEP))
+		write();
+}
+
+void LoraSession::forget(void)
+{
+	_valid = false;
+	EEPROM.update(EEPROM_LORA_SESSION, 0);	// clears the version byte
+}
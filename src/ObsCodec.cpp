@@ -0,0 +1,210 @@
+/*
+ * ObsCodec.cpp - keyframe / field-mask delta coding of reports
+ */
+
+#include <string.h>
+#include "ObsCodec.h"
+
+#define BaseLen   (sizeof(obsSet) + sizeof(obsStamp))
+
+static uint8_t putVarint(uint8_t *p, uint32_t v)
+{
+	uint8_t n = 0;
+	while (v >= 0x80) {
+		p[n++] = (uint8_t)v | 0x80;
+		v >>= 7;
+	}
+	p[n++] = (uint8_t)v;
+	return n;
+}
+
+static bool getVarint(const uint8_t *p, uint8_t avail, uint8_t &pos, uint32_t &v)
+{
+	v = 0;
+	for (uint8_t shift = 0; shift < 35; shift += 7) {
+		if (pos >= avail)
+			return false;
+		uint8_t b = p[pos++];
+		v |= (uint32_t)(b & 0x7F) << shift;
+		if (!(b & 0x80))
+			return true;
+	}
+	return false;
+}
+
+static inline uint16_t zigzag(int16_t d) { return ((uint16_t)d << 1) ^ (uint16_t)(d >> 15); }
+static inline int16_t unzigzag(uint16_t z) { return (int16_t)((z >> 1) ^ (uint16_t)-(int16_t)(z & 1)); }
+
+// obsSet field i, read bytewise as the payload is packed
+static inline uint16_t field(const obsPayload &p, uint8_t i)
+{
+	return p.readAccess()[2 * i] | (p.readAccess()[2 * i + 1] << 8);
+}
+
+static inline void setField(obsPayload &p, uint8_t i, uint16_t v)
+{
+	p.readAccess()[2 * i] = (uint8_t)v;
+	p.readAccess()[2 * i + 1] = (uint8_t)(v >> 8);
+}
+
+static uint8_t unpack(const uint8_t *report, uint8_t len, obsPayload &r)
+{
+	if (len > sizeof(r))
+		len = sizeof(r);
+	memset(&r, 0, sizeof(r));
+	memcpy(r.readAccess(), report, len);
+	return len;
+}
+
+// Diff of r from base; dt is the (non-negative) frameBase difference between them
+static uint8_t putDiff(const obsPayload &base, const obsPayload &r, bool rained, uint32_t dt, uint8_t *out)
+{
+	uint16_t mask = 0;
+	uint8_t n = 2;						// mask first
+	n += putVarint(&out[n], dt);
+	for (uint8_t i = 0; i < ObsFields; i++) {
+		uint16_t now = field(r, i), was = field(base, i);
+		if (now != was) {
+			mask |= 1 << i;
+			n += putVarint(&out[n], zigzag((int16_t)(now - was)));
+		}
+	}
+	if (r.stamp.gustOffset != base.stamp.gustOffset) {
+		mask |= Mask_Gust;
+		n += putVarint(&out[n], zigzag(r.stamp.gustOffset));
+	}
+	if (rained) {
+		mask |= Mask_Rain;
+		n += putVarint(&out[n], r.rainExt.rainPeakX10);
+		n += putVarint(&out[n], zigzag(r.rainExt.firstTipOffset));
+	}
+	out[0] = (uint8_t)mask;
+	out[1] = (uint8_t)(mask >> 8);
+	return n;
+}
+
+// Apply a diff (body[pos..avail)) to base.  later: the diffed report is later than base
+static bool getDiff(const obsPayload &base, const uint8_t *body, uint8_t avail, uint8_t pos, bool later,
+					obsPayload &out, uint8_t &len)
+{
+	uint32_t v;
+	if (pos + 2 > avail)
+		return false;
+	uint16_t mask = body[pos] | (body[pos + 1] << 8);
+	pos += 2;
+
+	out = base;
+	len = BaseLen;
+	if (!getVarint(body, avail, pos, v))
+		return false;
+	out.stamp.frameBase = later ? base.stamp.frameBase + v : base.stamp.frameBase - v;
+	for (uint8_t i = 0; i < ObsFields; i++) {
+		if (mask & (1 << i)) {
+			if (!getVarint(body, avail, pos, v))
+				return false;
+			setField(out, i, field(out, i) + unzigzag((uint16_t)v));
+		}
+	}
+	if (mask & Mask_Gust) {
+		if (!getVarint(body, avail, pos, v))
+			return false;
+		out.stamp.gustOffset = unzigzag((uint16_t)v);
+	}
+	if (mask & Mask_Rain) {
+		if (!getVarint(body, avail, pos, v))
+			return false;
+		out.rainExt.rainPeakX10 = v;
+		if (!getVarint(body, avail, pos, v))
+			return false;
+		out.rainExt.firstTipOffset = unzigzag((uint16_t)v);
+		len += sizeof(obsRainExt);
+	} else
+		memset(&out.rainExt, 0, sizeof(out.rainExt));
+	return pos == avail;
+}
+
+ObsEncoder::ObsEncoder()
+{
+	memset(&_last, 0, sizeof(_last));
+	_haveLast = false;
+}
+
+// A delta from the previous report in the frame when it is smaller, else a keyframe
+uint8_t ObsEncoder::encode(const uint8_t *report, uint8_t len, uint8_t *out)
+{
+	obsPayload r;
+	len = unpack(report, len, r);
+	bool rained = (len > BaseLen);
+
+	if (_haveLast && (r.stamp.frameBase >= _last.stamp.frameBase)) {
+		uint8_t delta[1 + CODEC_DIFF_MAX];
+		uint8_t n = 1 + putDiff(_last, r, rained, r.stamp.frameBase - _last.stamp.frameBase, &delta[1]);
+		if (n < len + 1) {
+			delta[0] = n - 1;
+			memcpy(out, delta, n);
+			_last = r;
+			return n;
+		}
+	}
+
+	_last = r;
+	_haveLast = true;
+	out[0] = CODEC_KEY_FLAG | len;
+	memcpy(&out[1], report, len);
+	return len + 1;
+}
+
+uint8_t ObsEncoder::echo(const uint8_t *ref, uint8_t refLen, const uint8_t *report, uint8_t len, uint8_t *out)
+{
+	obsPayload base, r;
+	unpack(ref, refLen, base);
+	len = unpack(report, len, r);
+	if (r.stamp.frameBase > base.stamp.frameBase)
+		return 0;
+	uint8_t diff[CODEC_DIFF_MAX];
+	uint8_t n = putDiff(base, r, len > BaseLen, base.stamp.frameBase - r.stamp.frameBase, diff);
+	if (n + 1 >= len + 1)
+		return 0;
+	out[0] = CODEC_ECHO_FLAG | n;
+	memcpy(&out[1], diff, n);
+	return n + 1;
+}
+
+ObsDecoder::ObsDecoder()
+{
+	memset(&_last, 0, sizeof(_last));
+	_haveLast = false;
+}
+
+uint8_t ObsDecoder::decode(const uint8_t *buf, uint8_t avail, uint8_t &used, obsPayload &out, uint8_t &len)
+{
+	used = 0;
+	if (avail < 2)
+		return Codec_Fail;
+	uint8_t bodyLen = buf[0] & CODEC_LEN_MASK;
+	if (1 + bodyLen > avail)
+		return Codec_Fail;
+	used = 1 + bodyLen;
+	const uint8_t *body = &buf[1];
+
+	if (buf[0] & CODEC_ECHO_FLAG) {
+		if (!_haveLast || !getDiff(_last, body, bodyLen, 0, false, out, len))
+			return Codec_Fail;
+		return Codec_Echo;
+	}
+
+	bool ok;
+	if (buf[0] & CODEC_KEY_FLAG) {
+		ok = (bodyLen >= BaseLen) && (bodyLen <= sizeof(obsPayload));
+		if (ok)
+			len = unpack(body, bodyLen, out);
+	} else
+		ok = _haveLast && getDiff(_last, body, bodyLen, 0, true, out, len);
+	if (!ok) {
+		_haveLast = false;				// the deltas after it can't be placed either
+		return Codec_Fail;
+	}
+	_last = out;
+	_haveLast = true;
+	return Codec_Report;
+}
@@ -0,0 +1,30 @@
+/*
+ * PulseCounter.cpp - hardware pulse counting on the Mega's Timer/Counter5
+ */
+
+#include "PulseCounter.h"
+
+PulseCounter5::PulseCounter5()
+{
+	_last = 0;
+}
+
+void PulseCounter5::begin(void)
+{
+	pinMode(PulseCounter5_Pin, INPUT);
+	TCCR5A = 0;							// normal mode, no output compare pins
+	TCCR5B = 0;							// stop while resetting
+	TCNT5 = 0;
+	_last = 0;
+	TCCR5B = (1 << CS52) | (1 << CS51);	// external clock on T5, falling edge
+}
+
+// The counter free-runs and wraps at 16 bits; unsigned subtraction gives the correct delta
+// as long as fewer than 65536 pulses arrive between calls
+uint16_t PulseCounter5::delta(void)
+{
+	uint16_t count = TCNT5;
+	uint16_t pulses = count - _last;
+	_last = count;
+	return pulses;
+}
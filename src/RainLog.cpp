@@ -0,0 +1,46 @@
+/*
+ * RainLog.cpp - per-tip rain gauge timestamps & peak intensity
+ */
+
+#include "RainLog.h"
+
+#define RainWindow  ((rainTick_t)(RainWindow_sec * STATION_TICKS_PER_SEC))
+
+RainLog::RainLog()
+{
+	_scanned = 0;
+}
+
+// The ring holds the tips of the last minute (already summarised) followed by the new tips.
+// Each new tip closes a 1 minute window; tips older than the window are released from the
+// tail, so the tips remaining up to & including this one are the count for that minute.
+bool RainLog::summarise(stamp_t now, uint8_t &peakTips, stamp_t &firstTip)
+{
+	rainTick_t reportTime = (rainTick_t)now;
+	uint8_t available = _tips.count();
+	bool rained = (_scanned < available);
+
+	peakTips = 0;
+	if (rained)		// widen the 16 bit stamp back to a full one - tips are never 9 hrs old
+		firstTip = now - (int16_t)(reportTime - _tips.peek(_scanned));
+
+	while (_scanned < available) {
+		rainTick_t t = _tips.peek(_scanned);
+		while ((rainTick_t)(t - _tips.peek(0)) >= RainWindow) {
+			_tips.drop();
+			_scanned--;
+			available--;
+		}
+		_scanned++;
+		if (_scanned > peakTips)
+			peakTips = _scanned;
+	}
+
+	// Only the trailing minute is needed next time; this also keeps old stamps from wrapping
+	// (signed: a tip may have landed between the report tick and this call)
+	while (_scanned && ((int16_t)(reportTime - _tips.peek(0)) >= (int16_t)RainWindow)) {
+		_tips.drop();
+		_scanned--;
+	}
+	return rained;
+}
@@ -0,0 +1,60 @@
+/*
+ * ReportFilter.cpp - change-driven reporting with per-channel deadbands
+ */
+
+#include "ReportFilter.h"
+
+ReportFilter::ReportFilter()
+{
+	memset(&_bands, 0, sizeof(_bands));
+	_haveRef = false;
+	_skipRun = 0;
+	_skippedTotal = 0;
+}
+
+bool ReportFilter::moved(uint16_t now, uint16_t ref, uint8_t band)
+{
+	if (!band)
+		return false;
+	uint16_t diff = (now > ref) ? now - ref : ref - now;
+	return diff >= band;
+}
+
+bool ReportFilter::urgent(bool raining, uint16_t gustX10) const
+{
+	if (!_haveRef || !_bands.heartbeat)
+		return false;
+	return (raining && !_ref.rainflX10)
+			|| (_bands.gustSpikeX10 && (gustX10 >= _ref.windGustX10 + _bands.gustSpikeX10));
+}
+
+uint8_t ReportFilter::check(const obsSet &obs)
+{
+	uint8_t verdict = Report_Skip;
+
+	if (!_haveRef || !_bands.heartbeat)
+		verdict = Report_Send;
+	else if (urgent(obs.rainflX10 != 0, obs.windGustX10))
+		verdict = Report_Urgent;			// ahead of the heartbeat, so it isn't delayed
+	else if (_skipRun >= _bands.heartbeat)
+		verdict = Report_Send;
+	else if (moved(obs.tempX10, _ref.tempX10, _bands.tempX10)
+			|| moved(obs.casetempX10, _ref.casetempX10, _bands.tempX10)
+			|| moved(obs.pressX10, _ref.pressX10, _bands.pressX10)
+			|| moved(obs.humidX10, _ref.humidX10, _bands.humidX10)
+			|| moved(obs.windspX10, _ref.windspX10, _bands.windX10)
+			|| moved(obs.windGustX10, _ref.windGustX10, _bands.windX10)
+			|| moved(obs.rainflX10, _ref.rainflX10, _bands.rainX10)
+			|| moved(obs.dailyRainX10, _ref.dailyRainX10, _bands.rainX10))
+		verdict = Report_Send;
+
+	if (verdict == Report_Skip) {
+		_skipRun++;
+		if (_skippedTotal != 0xFFFF) _skippedTotal++;
+	} else {
+		_ref = obs;
+		_haveRef = true;
+		_skipRun = 0;
+	}
+	return verdict;
+}
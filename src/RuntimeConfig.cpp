@@ -0,0 +1,140 @@
+/*
+ * RuntimeConfig.cpp - station settings changed by downlink & kept in EEPROM
+ */
+
+#include <EEPROM.h>
+#include <util/crc16.h>
+#include "RuntimeConfig.h"
+#include "EepromMap.h"
+#include "TxPlanner.h"
+#include "VaneTable.h"
+
+#define Cmd_SampleInterval   0x01
+#define Cmd_ReportInterval   0x02
+#define Cmd_TxDelay          0x03
+#define Cmd_AirResolution    0x04
+#define Cmd_CaseResolution   0x05
+#define Cmd_VaneOffset       0x06
+#define Cmd_PayloadVariant   0x07
+#define Cmd_Heartbeat        0x08
+#define Cmd_TempBand         0x09
+#define Cmd_PressBand        0x0A
+#define Cmd_HumidBand        0x0B
+#define Cmd_WindBand         0x0C
+#define Cmd_RainBand         0x0D
+#define Cmd_GustSpike        0x0E
+#define Cmd_Redundancy       0x0F
+#define Cmd_Defaults         0xF0
+
+// EEPROM layout at EEPROM_RUNTIME_CFG:  CONFIG_VERSION, StationSettings, default vane offset
+// when saved (i16), CRC8
+#define CfgSettingsAddr  (EEPROM_RUNTIME_CFG + 1)
+#define CfgVaneCalAddr   (CfgSettingsAddr + sizeof(StationSettings))
+#define CfgCrcAddr       (CfgVaneCalAddr + sizeof(int16_t))
+
+RuntimeConfig::RuntimeConfig(const StationSettings &defaults, unsigned long tickUs)
+	: _defaults(defaults)
+{
+	_tickUs = tickUs;
+	_settings = defaults;
+	_pending = false;
+}
+
+bool RuntimeConfig::begin(void)
+{
+	StationSettings s;
+	if (EEPROM.read(EEPROM_RUNTIME_CFG) != CONFIG_VERSION)
+		return false;
+	int16_t vaneCal;
+	EEPROM.get(CfgSettingsAddr, s);
+	EEPROM.get(CfgVaneCalAddr, vaneCal);
+	if ((EEPROM.read(CfgCrcAddr) != crc(s, vaneCal)) || !valid(s))
+		return false;
+	_settings = s;
+	// The default vane offset is the one calibrated into the vane table.  A downlinked offset
+	// was set against the table flashed at the time - after a new calibration it is dropped
+	if (vaneCal != _defaults.vaneOffset) {
+		_settings.vaneOffset = _defaults.vaneOffset;
+		save();
+	}
+	return true;
+}
+
+uint8_t RuntimeConfig::crc(const StationSettings &s, int16_t vaneCal)
+{
+	const uint8_t *p = (const uint8_t *)&s;
+	uint8_t c = CONFIG_VERSION;
+	for (uint8_t i = 0; i < sizeof(s); i++)
+		c = _crc8_ccitt_update(c, p[i]);
+	c = _crc8_ccitt_update(c, (uint8_t)vaneCal);
+	return _crc8_ccitt_update(c, (uint8_t)(vaneCal >> 8));
+}
+
+bool RuntimeConfig::valid(const StationSettings &s) const
+{
+	uint32_t reportSec = (uint32_t)s.sampleInterval * s.reportInterval * _tickUs / 1000000UL;
+	return (s.sampleInterval >= 1) && (s.reportInterval >= 1)
+		&& (reportSec >= MinReportSec) && (s.txDelaySec < reportSec)
+		&& (s.airResolution >= 9) && (s.airResolution <= 12)
+		&& (s.caseResolution >= 9) && (s.caseResolution <= 12)
+		&& (s.vaneOffset - VANE_TABLE_OFFSET > -360) && (s.vaneOffset - VANE_TABLE_OFFSET < 360)
+		&& (s.payloadVariant <= TxVariant_Delta)
+		&& (s.redundancy <= REDUNDANCY_MAX);
+}
+
+// EEPROM.put() only rewrites bytes that differ
+void RuntimeConfig::save(void)
+{
+	EEPROM.update(EEPROM_RUNTIME_CFG, CONFIG_VERSION);
+	EEPROM.put(CfgSettingsAddr, _settings);
+	EEPROM.put(CfgVaneCalAddr, _defaults.vaneOffset);
+	EEPROM.update(CfgCrcAddr, crc(_settings, _defaults.vaneOffset));
+}
+
+bool RuntimeConfig::handleDownlink(const uint8_t *cmd, uint8_t len)
+{
+	StationSettings s = _settings;
+	uint8_t i = 0;
+
+	while (i < len) {
+		uint8_t op = cmd[i++];
+		if (op == Cmd_Defaults) {
+			s = _defaults;
+			continue;
+		}
+		if (op == Cmd_VaneOffset) {
+			if (i + 2 > len)
+				return false;
+			s.vaneOffset = (int16_t)(cmd[i] | (cmd[i + 1] << 8));
+			i += 2;
+			continue;
+		}
+		if (i >= len)
+			return false;				// truncated command
+		uint8_t v = cmd[i++];
+		switch (op) {
+			case Cmd_SampleInterval:	s.sampleInterval = v;	break;
+			case Cmd_ReportInterval:	s.reportInterval = v;	break;
+			case Cmd_TxDelay:			s.txDelaySec = v;		break;
+			case Cmd_AirResolution:		s.airResolution = v;	break;
+			case Cmd_CaseResolution:	s.caseResolution = v;	break;
+			case Cmd_PayloadVariant:	s.payloadVariant = v;	break;
+			case Cmd_Heartbeat:			s.deadbands.heartbeat = v;		break;
+			case Cmd_TempBand:			s.deadbands.tempX10 = v;		break;
+			case Cmd_PressBand:			s.deadbands.pressX10 = v;		break;
+			case Cmd_HumidBand:			s.deadbands.humidX10 = v;		break;
+			case Cmd_WindBand:			s.deadbands.windX10 = v;		break;
+			case Cmd_RainBand:			s.deadbands.rainX10 = v;		break;
+			case Cmd_GustSpike:			s.deadbands.gustSpikeX10 = v;	break;
+			case Cmd_Redundancy:		s.redundancy = v;				break;
+			default:					return false;			// unknown - reject the whole downlink
+		}
+	}
+
+	if (!valid(s) || (memcmp(&s, &_settings, sizeof(s)) == 0))
+		return false;
+	_settings = s;
+	save();
+	_pending = true;
+	return true;
+}
@@ -0,0 +1,114 @@
+/*
+ * SampleClock.cpp - Timer1 sample clock disciplined by the SD2405 1Hz output
+ */
+
+#include "SampleClock.h"
+#include "TimerOne.h"
+
+SampleClock::SampleClock()
+{
+	_nominal = 0;
+	_locked = false;
+	_measured = false;
+	_reported = false;
+	_ticks = 0;
+	_seconds = 0;
+	_phaseErr = 0;
+	_newPeriod = 0;
+}
+
+void SampleClock::begin(unsigned long periodUs)
+{
+	_nominal = periodUs;
+	_base = periodUs;
+	_period = periodUs;
+	_locked = false;
+	_reported = false;
+}
+
+// Timer1 interrupts at BOTTOM, so this is also the safe point to change its TOP (ICR1)
+void SampleClock::tick(void)
+{
+	_ticks++;
+	_lastTickUs = micros();
+	if (_newPeriod) {
+		Timer1.setPeriod(_newPeriod);
+		_newPeriod = 0;
+	}
+}
+
+// The first edge restarts Timer1 so that ticks fall on RTC second boundaries.  After that
+// a snapshot of tick count & fraction is taken at the end of each discipline window
+void SampleClock::rtcEdge(void)
+{
+	unsigned long nowUs = micros();
+
+	if (!_locked) {
+		Timer1.restart();
+		_ticks = 0;
+		_seconds = 0;
+		_lastTickUs = nowUs;
+		_prevTicks = 0;
+		_prevFracUs = 0;
+		_locked = true;
+		return;
+	}
+	if ((++_seconds % DISCIPLINE_WINDOW) == 0) {
+		_edgeTicks = _ticks;
+		_edgeFracUs = nowUs - _lastTickUs;
+		_measured = true;
+	}
+}
+
+bool SampleClock::discipline(void)
+{
+	if (!_locked)
+		return false;
+	if (!_reported) {
+		_reported = true;
+		return true;
+	}
+	if (!_measured)
+		return false;
+
+	noInterrupts();
+	unsigned long ticks = _edgeTicks;
+	unsigned long fracUs = _edgeFracUs;
+	_measured = false;
+	interrupts();
+
+	// station time elapsed over the window, less the RTC's DISCIPLINE_WINDOW seconds
+	long stationUs = (long)(ticks - _prevTicks) * (long)_nominal + (long)fracUs - (long)_prevFracUs;
+	_phaseErr += stationUs - DISCIPLINE_WINDOW * 1000000L;
+	_prevTicks = ticks;
+	_prevFracUs = fracUs;
+
+	long ticksPerWindow = DISCIPLINE_WINDOW * 1000000L / (long)_nominal;
+	long maxTrim = (long)(_nominal / 1000000.0 * MAX_TRIM_PPM);
+	_base = constrain(_base + _phaseErr / (2 * ticksPerWindow), (long)_nominal - maxTrim, (long)_nominal + maxTrim);
+	long period = constrain(_base + _phaseErr / ticksPerWindow, (long)_nominal - maxTrim, (long)_nominal + maxTrim);
+
+	if (period != _period) {
+		_period = period;
+		noInterrupts();
+		_newPeriod = period;				// applied by the next tick()
+		interrupts();
+	}
+	return false;
+}
+
+unsigned long SampleClock::ticksSinceLock(void)
+{
+	noInterrupts();
+	unsigned long t = _ticks;
+	interrupts();
+	return t;
+}
+
+unsigned long SampleClock::secondsSinceLock(void)
+{
+	noInterrupts();
+	unsigned long s = _seconds;
+	interrupts();
+	return s;
+}
@@ -0,0 +1,40 @@
+/*
+ * StationClock.cpp - monotonic station time from the Timing_Clock tick
+ */
+
+#include "StationClock.h"
+
+StationClock::StationClock()
+{
+	_ticks = 0;
+	_baseUtc = 0;
+	_baseStamp = 0;
+}
+
+stamp_t StationClock::now(void) const
+{
+	noInterrupts();
+	stamp_t t = _ticks;
+	interrupts();
+	return t;
+}
+
+void StationClock::sync(time_t utc, stamp_t at)
+{
+	_baseUtc = utc;
+	_baseStamp = at;
+}
+
+// Ticks either side of the sync point, rounded down to whole seconds (also before it)
+time_t StationClock::toUtc(stamp_t t) const
+{
+	int32_t ticks = (int32_t)(t - _baseStamp);
+	if (ticks >= 0)
+		return _baseUtc + ticks / STATION_TICKS_PER_SEC;
+	return _baseUtc - (uint32_t)(STATION_TICKS_PER_SEC - 1 - ticks) / STATION_TICKS_PER_SEC;
+}
+
+int32_t StationClock::ticksFrom(time_t utc, stamp_t t) const
+{
+	return (int32_t)(t - _baseStamp) - (int32_t)(utc - _baseUtc) * STATION_TICKS_PER_SEC;
+}
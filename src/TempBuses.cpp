@@ -0,0 +1,87 @@
+/*
+ * TempBuses.cpp - coordinated DS18B20 acquisition across several 1-Wire buses
+ */
+
+#include <Arduino.h>
+#include "TempBuses.h"
+
+TempBuses::TempBuses(DallasTemperature *buses, uint8_t busCount)
+{
+	_buses = buses;
+	_busCount = (busCount > MAX_TEMP_BUSES) ? MAX_TEMP_BUSES : busCount;
+	_probeCount = 0;
+	_pending = 0;
+	_started = 0;
+}
+
+// Enumerate every bus (detects parasite power & resolution) and stop the library blocking
+// in requestTemperatures() - completion is polled by harvest() instead
+void TempBuses::begin(void)
+{
+	for (uint8_t i = 0; i < _busCount; i++) {
+		_buses[i].begin();
+		_buses[i].setWaitForConversion(false);
+		_waitMs[i] = _buses[i].millisToWaitForConversion(_buses[i].getResolution());
+	}
+}
+
+int8_t TempBuses::addProbe(uint8_t bus, const uint8_t *deviceAddress)
+{
+	if ((_probeCount >= MAX_TEMP_PROBES) || (bus >= _busCount))
+		return -1;
+	_probeBus[_probeCount] = bus;
+	memcpy(_probeAddr[_probeCount], deviceAddress, sizeof(DeviceAddress));
+	_probeRaw[_probeCount] = DEVICE_DISCONNECTED_RAW;
+	return _probeCount++;
+}
+
+// Issue a skip-ROM convert on each bus back to back; the conversions then run concurrently.
+// A conversion still outstanding from the previous request (a 12 bit probe, or a parasite bus
+// read on its worst-case time, can outlast a sample) is left to finish rather than restarted
+void TempBuses::requestTemperatures(void)
+{
+	if (!harvest())
+		return;				// collect the previous request first - restart next sample
+	for (uint8_t i = 0; i < _busCount; i++) {
+		_buses[i].requestTemperatures();
+		_pending |= (1 << i);
+	}
+	_started = millis();
+}
+
+// Poll the buses with a conversion outstanding and read the probes on any that have finished.
+// A parasite-powered bus cannot signal completion, so it is read once its worst-case time is up.
+bool TempBuses::harvest(void)
+{
+	if (!_pending)
+		return true;
+
+	unsigned long elapsed = millis() - _started;
+	for (uint8_t i = 0; i < _busCount; i++) {
+		if (!(_pending & (1 << i)))
+			continue;
+		bool done = (elapsed >= (unsigned long)_waitMs[i]);
+		if (!done && !_buses[i].isParasitePowerMode())
+			done = _buses[i].isConversionComplete();
+		if (done) {
+			readBus(i);
+			_pending &= ~(1 << i);
+		}
+	}
+	return (_pending == 0);
+}
+
+int16_t TempBuses::getTemp(uint8_t probe)
+{
+	if (probe >= _probeCount)
+		return DEVICE_DISCONNECTED_RAW;
+	return _probeRaw[probe];
+}
+
+void TempBuses::readBus(uint8_t bus)
+{
+	for (uint8_t p = 0; p < _probeCount; p++) {
+		if (_probeBus[p] == bus)
+			_probeRaw[p] = _buses[bus].getTemp(_probeAddr[p]);
+	}
+}
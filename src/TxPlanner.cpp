@@ -0,0 +1,300 @@
+/*
+ * TxPlanner.cpp - airtime-aware scheduling of LoRaWAN uplinks
+ */
+
+#include "TxPlanner.h"
+
+#define BudgetUsPerSec   (TX_BUDGET_MS * 1000UL / 86400UL)	// token refill rate (rounded down)
+#define BucketCapUs      (TX_BUDGET_MS * 1000UL / 24 * TX_BURST_HOURS)
+
+// AU915 uplink data rates: DR0-5 = SF12-SF7 at 125kHz, DR6 = SF8 at 500kHz
+static const uint8_t maxPayloadAU915[] PROGMEM = { 51, 51, 51, 115, 242, 242, 242 };
+
+TxPlanner::TxPlanner(uint8_t coreLen)
+{
+	_coreLen = coreLen;
+	_interval = 0;
+	_variant = TxVariant_Auto;
+	_redundancy = 0;
+	_historyCount = 0;
+	_frameLen = 0;
+	_framePort = TxPort_Single;
+	_plannedObs = 0;
+	_plannedAirUs = 0;
+	_tokensUs = TX_BUDGET_MS * 1000UL / 24;		// start with one hour's share
+	_lastRefill = 0;
+	memset(_ledgerMs, 0, sizeof(_ledgerMs));
+	_ledgerHour = 0;
+	_framesSent = 0;
+	_obsSent = 0;
+	_obsDropped = 0;
+}
+
+// LoRa time-on-air (Semtech AN1200.13): explicit header, CRC on, coding rate 4/5, 8 symbol preamble.
+// Worked in quarter symbols so the 4.25 symbol sync word stays integral.
+uint32_t TxPlanner::airtimeUs(uint8_t dr, uint8_t payloadLen)
+{
+	uint8_t sf = (dr <= 5) ? 12 - dr : 8;
+	bool bw500 = (dr > 5);
+	uint8_t de = (!bw500 && sf >= 11) ? 1 : 0;		// low data rate optimisation
+	int16_t num = 8 * (int16_t)(payloadLen + TX_MAC_OVERHEAD) - 4 * sf + 28 + 16;
+	int16_t den = 4 * (sf - 2 * de);
+	uint16_t payloadSymbols = 8;
+	if (num > 0)
+		payloadSymbols += ((num + den - 1) / den) * 5;
+	uint16_t quarterSymbolUs = bw500 ? (1 << (sf - 1)) : (2 << sf);
+	return (uint32_t)(4 * (8 + payloadSymbols) + 17) * quarterSymbolUs;
+}
+
+uint8_t TxPlanner::maxPayload(uint8_t dr)
+{
+	if (dr >= sizeof(maxPayloadAU915))
+		dr = 0;
+	return pgm_read_byte(&maxPayloadAU915[dr]);
+}
+
+bool TxPlanner::enqueue(const uint8_t *report, uint8_t len, uint32_t frameBase)
+{
+	bool kept = true;
+	if (_queue.count() == OBS_QUEUE_SIZE - 1) {	// full - make room by losing the oldest
+		_queue.drop();
+		if (_obsDropped != 0xFFFF) _obsDropped++;
+		kept = false;
+	}
+	ObsRecord r;
+	r.frameBase = frameBase;
+	r.len = (len > OBS_RECORD_MAX) ? OBS_RECORD_MAX : len;
+	memcpy(r.data, report, r.len);
+	_queue.push(r);
+	return kept;
+}
+
+uint8_t TxPlanner::held(ObsRecord *out, uint8_t max) const
+{
+	uint8_t n = _queue.count();
+	if (n > max)
+		n = max;
+	for (uint8_t i = 0; i < n; i++)
+		out[i] = _queue.peek(i);
+	return n;
+}
+
+void TxPlanner::restore(const ObsRecord *in, uint8_t n)
+{
+	for (uint8_t i = 0; i < n; i++)
+		enqueue(in[i].data, in[i].len, in[i].frameBase);
+}
+
+void TxPlanner::budget(Budget &out) const
+{
+	out.tokensUs = _tokensUs;
+	out.lastRefill = _lastRefill;
+	memcpy(out.ledgerMs, _ledgerMs, sizeof(_ledgerMs));
+	out.ledgerHour = _ledgerHour;
+}
+
+void TxPlanner::restoreBudget(const Budget &in)
+{
+	_tokensUs = (in.tokensUs > BucketCapUs) ? BucketCapUs : in.tokensUs;
+	_lastRefill = in.lastRefill;
+	memcpy(_ledgerMs, in.ledgerMs, sizeof(_ledgerMs));
+	_ledgerHour = in.ledgerHour;
+}
+
+void TxPlanner::refill(time_t now)
+{
+	if ((_lastRefill == 0) || (now < _lastRefill)) {	// first call, or the clock was stepped back
+		_lastRefill = now;
+		return;
+	}
+	uint32_t elapsed = now - _lastRefill;
+	if (elapsed > TX_BURST_HOURS * 3600UL)
+		elapsed = TX_BURST_HOURS * 3600UL;
+	_tokensUs += elapsed * BudgetUsPerSec;
+	if (_tokensUs > BucketCapUs)
+		_tokensUs = BucketCapUs;
+	_lastRefill = now;
+}
+
+void TxPlanner::rollLedger(time_t now)
+{
+	uint32_t hour = now / 3600;
+	if (hour <= _ledgerHour)
+		return;
+	uint32_t stale = hour - _ledgerHour;
+	if (stale > 24)
+		stale = 24;
+	while (stale--)
+		_ledgerMs[(hour - stale) % 24] = 0;
+	_ledgerHour = hour;
+}
+
+uint32_t TxPlanner::usedMs(time_t now)
+{
+	rollLedger(now);
+	uint32_t used = 0;
+	for (uint8_t i = 0; i < 24; i++)
+		used += _ledgerMs[i];
+	return used;
+}
+
+// Pack as many queued reports (oldest first) as fit in maxLen, in the layout of the given port
+uint8_t TxPlanner::build(uint8_t port, uint8_t maxLen, uint8_t echoes)
+{
+	uint8_t available = _queue.count();
+	uint8_t n = 0;
+	_frameLen = 0;
+	_framePort = port;
+
+	if (port == TxPort_Delta) {			// a keyframe, then deltas - the frame decodes on its own
+		ObsEncoder encoder;
+		while (n < available) {
+			ObsRecord r = _queue.peek(n);
+			ObsEncoder e = encoder;
+			uint8_t rec[CODEC_RECORD_MAX];
+			uint8_t len = e.encode(r.data, r.len, rec);
+			if (_frameLen + len > maxLen)
+				break;
+			memcpy(&_frame[_frameLen], rec, len);
+			_frameLen += len;
+			encoder = e;
+			n++;
+		}
+		if (echoes && n) {				// copies of earlier reports, diffed from the newest in the frame
+			ObsRecord ref = _queue.peek(n - 1);
+			for (uint8_t i = 0; (i < echoes) && (i < _historyCount); i++) {
+				uint8_t rec[CODEC_RECORD_MAX];
+				uint8_t len = ObsEncoder::echo(ref.data, ref.len, _history[i].data, _history[i].len, rec);
+				if (!len || (_frameLen + len > maxLen))
+					break;
+				memcpy(&_frame[_frameLen], rec, len);
+				_frameLen += len;
+			}
+		}
+		return n;
+	}
+
+	if (port == TxPort_Compact) {
+		ObsRecord first = _queue.peek(0);
+		if (sizeof(first.frameBase) + _coreLen > maxLen)
+			return 0;
+		memcpy(_frame, &first.frameBase, sizeof(first.frameBase));
+		_frameLen = sizeof(first.frameBase);
+		while (n < available && _frameLen + _coreLen <= maxLen) {
+			ObsRecord r = _queue.peek(n);
+			if (r.frameBase != first.frameBase + (uint32_t)n * _interval)
+				break;					// reports must be consecutive to be timed from the header
+			memcpy(&_frame[_frameLen], r.data, _coreLen);
+			_frameLen += _coreLen;
+			n++;
+		}
+		return n;
+	}
+
+	while (n < available) {
+		ObsRecord r = _queue.peek(n);
+		if (_frameLen + 1 + r.len > maxLen)
+			break;
+		_frame[_frameLen++] = r.len;
+		memcpy(&_frame[_frameLen], r.data, r.len);
+		_frameLen += r.len;
+		n++;
+	}
+	if (n == 1) {						// a lone report goes out in the original port 1 layout
+		_frameLen--;
+		memmove(_frame, &_frame[1], _frameLen);
+		_framePort = TxPort_Single;
+	}
+	return n;
+}
+
+// Choose the frame that clears the most queued reports within the airtime that may be spent
+// now; full reports are preferred, the compact batch only when it clears more of the queue
+// (unless the payload variant is fixed by configuration).
+bool TxPlanner::plan(time_t now, uint8_t dr)
+{
+	refill(now);
+	uint8_t available = _queue.count();
+	_plannedObs = 0;
+	if (!available)
+		return false;
+
+	uint8_t maxLen = maxPayload(dr);
+	if (maxLen > TX_FRAME_MAX)
+		maxLen = TX_FRAME_MAX;
+	uint32_t spendUs = remainingMs(now) * 1000UL;
+	if (_tokensUs < spendUs)
+		spendUs = _tokensUs;
+
+	if ((_variant == TxVariant_Delta) || _redundancy) {
+		uint8_t echoes = _redundancy;
+		_plannedObs = build(TxPort_Delta, maxLen, echoes);
+		while (echoes && (airtimeUs(dr, _frameLen) > spendUs))
+			_plannedObs = build(TxPort_Delta, maxLen, --echoes);	// drop the echoes it can't afford, oldest first
+		_plannedAirUs = airtimeUs(dr, _frameLen);
+		if (_plannedAirUs > spendUs)
+			_plannedObs = 0;
+		return _plannedObs != 0;
+	}
+
+	uint8_t fullObs = 0;
+	if (_variant != TxVariant_Compact) {
+		fullObs = build(TxPort_Batch, maxLen);
+		if (airtimeUs(dr, _frameLen) > spendUs)
+			fullObs = 0;
+	}
+	if ((fullObs < available) && (_variant != TxVariant_Full)) {
+		uint8_t compactObs = build(TxPort_Compact, maxLen);
+		if ((compactObs > fullObs) && (airtimeUs(dr, _frameLen) <= spendUs)) {
+			_plannedObs = compactObs;
+			_plannedAirUs = airtimeUs(dr, _frameLen);
+			return true;
+		}
+		if (fullObs)
+			build(TxPort_Batch, maxLen);
+	}
+	if (!fullObs)
+		return false;					// hold - the reports will go out batched once the budget allows
+	_plannedObs = fullObs;
+	_plannedAirUs = airtimeUs(dr, _frameLen);
+	return true;
+}
+
+// The oldest report alone, costed as sent on its own (a delta keyframe is no longer), against
+// the token bucket's refill and the 24 hour ledger - an hour's entry ages out at the hour
+uint32_t TxPlanner::retryInSec(time_t now, uint8_t dr)
+{
+	if (!_queue.count())
+		return 0;
+	refill(now);
+	uint32_t needUs = airtimeUs(dr, _queue.peek(0).len);
+	uint32_t waitSec = 0;
+	if (_tokensUs < needUs)
+		waitSec = (needUs - _tokensUs + BudgetUsPerSec - 1) / BudgetUsPerSec;
+	if (remainingMs(now) * 1000UL < needUs) {
+		uint32_t toHour = 3600 - now % 3600;
+		if (toHour > waitSec)
+			waitSec = toHour;
+	}
+	return waitSec;
+}
+
+void TxPlanner::sent(time_t now)
+{
+	rollLedger(now);
+	uint16_t ms = (_plannedAirUs + 999) / 1000;
+	uint16_t &slot = _ledgerMs[_ledgerHour % 24];
+	slot = (slot > 0xFFFF - ms) ? 0xFFFF : slot + ms;
+	_tokensUs = (_tokensUs > _plannedAirUs) ? _tokensUs - _plannedAirUs : 0;
+
+	for (uint8_t i = 0; i < _plannedObs; i++) {
+		if (REDUNDANCY_MAX > 1)
+			memmove(&_history[1], &_history[0], (REDUNDANCY_MAX - 1) * sizeof(ObsRecord));
+		_history[0] = _queue.peek(0);
+		if (_historyCount < REDUNDANCY_MAX) _historyCount++;
+		_queue.drop();
+	}
+	_obsSent += _plannedObs;
+	_framesSent++;
+	_plannedObs = 0;
+}
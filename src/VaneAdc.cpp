@@ -0,0 +1,86 @@
+/*
+ * VaneAdc.cpp - background oversampling of the wind vane on the Mega's ADC
+ */
+
+#include "VaneAdc.h"
+#define VANE_TABLE_DATA
+#include "VaneTable.h"
+
+#define HalfTurn  (VANE_ADC_COUNTS / 2)
+
+static VaneAdc *activeVane;
+
+VaneAdc::VaneAdc()
+{
+	_sum = 0;
+	_count = 0;
+	_ref = 0;
+	_mean = 0;
+	_lastCount = 0;
+}
+
+void VaneAdc::begin(uint8_t channel)
+{
+	activeVane = this;
+	ADCSRA = 0;								// stop any conversion in progress
+	ADMUX = (1 << REFS0) | (channel & 0x07);	// AVcc reference, right adjusted
+	ADCSRB = ((channel & 0x08) ? (1 << MUX5) : 0) | (1 << ADTS2);	// trigger on Timer0 overflow
+	if (channel >= 8)
+		DIDR2 |= 1 << (channel - 8);		// digital input buffer off - less noise & current
+	// 16MHz / 128 = 125kHz ADC clock (104us conversion), auto trigger, interrupt on complete
+	ADCSRA = (1 << ADEN) | (1 << ADATE) | (1 << ADIF) | (1 << ADIE)
+				| (1 << ADPS2) | (1 << ADPS1) | (1 << ADPS0);
+}
+
+void VaneAdc::convert(uint16_t reading)
+{
+	if (_count == 0xFFFF)
+		return;								// enough for the mean - rest of a very long interval ignored
+	if (_count == 0) {
+		_ref = reading;
+		_sum = 0;
+	} else {
+		int16_t offset = (int16_t)reading - (int16_t)_ref;
+		if (offset > HalfTurn) offset -= VANE_ADC_COUNTS;
+		else if (offset < -HalfTurn) offset += VANE_ADC_COUNTS;
+		_sum += offset;
+	}
+	_count++;
+}
+
+uint16_t VaneAdc::take(void)
+{
+	if (_count) {
+		int32_t half = _count / 2;
+		int16_t offset = (_sum >= 0) ? (_sum + half) / _count : -((-_sum + half) / (int32_t)_count);
+		_mean = (uint16_t)(_ref + offset + VANE_ADC_COUNTS) % VANE_ADC_COUNTS;
+	}
+	_lastCount = _count;
+	_count = 0;
+	return _mean;
+}
+
+int16_t VaneAdc::bearingX10(uint16_t counts)
+{
+	uint8_t i = (counts >> 4) & 0x3F;
+	uint8_t frac = counts & 0x0F;
+	int16_t from = pgm_read_word(&vaneTable[i]);
+	int16_t span = (int16_t)pgm_read_word(&vaneTable[i + 1]) - from;
+	if (span < -1800) span += 3600;			// segment crosses north
+	else if (span > 1800) span -= 3600;
+	int16_t bearing = from + ((span * frac + 8) >> 4);
+	if (bearing >= 3600) bearing -= 3600;
+	else if (bearing < 0) bearing += 3600;
+	return bearing;
+}
+
+int16_t VaneAdc::tableOffset(void)
+{
+	return VANE_TABLE_OFFSET;
+}
+
+ISR(ADC_vect)
+{
+	if (activeVane)
+		activeVane->convert(ADC);
+}
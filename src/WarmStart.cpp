@@ -0,0 +1,60 @@
+/*
+ * WarmStart.cpp - watchdog supervision & state kept in RAM over a reset
+ */
+
+#include <util/crc16.h>
+#include "WarmStart.h"
+
+// Left untouched by the C runtime at startup
+static WarmState warm __attribute__((section(".noinit")));
+static uint16_t warmCrc __attribute__((section(".noinit")));
+static uint8_t resetFlags __attribute__((section(".noinit")));
+
+// Runs before main(): the watchdog stays enabled (at its shortest timeout) after a
+// watchdog reset, so it must be stopped before the C++ constructors run.  The startup code
+// before .init3 leaves r2 alone, so Optiboot's copy of the flags is still there
+void warmStartInit(void) __attribute__((naked, used, section(".init3")));
+void warmStartInit(void)
+{
+	#ifdef WARM_OPTIBOOT_R2
+		__asm__ __volatile__ ("sts %0, r2" : "=m" (resetFlags));
+	#else
+		resetFlags = MCUSR;
+	#endif
+	MCUSR = 0;
+	wdt_disable();
+}
+
+uint16_t WarmStart::crc(void)
+{
+	const uint8_t *p = (const uint8_t *)&warm;
+	uint16_t c = 0xFFFF ^ WARM_VERSION;
+	for (uint16_t i = 0; i < sizeof(warm); i++)
+		c = _crc16_update(c, p[i]);
+	return c;
+}
+
+// With the stk500v2 bootloader resetFlags is always 0, leaving it all to the CRC
+bool WarmStart::restore(void)
+{
+	if ((resetFlags & (1 << PORF)) || (warm.obsCount > WARM_OBS_MAX) || (warmCrc != crc())) {
+		warmCrc = ~crc();				// stays invalid until the first checkpoint
+		return false;
+	}
+	return true;
+}
+
+WarmState &WarmStart::state(void)
+{
+	return warm;
+}
+
+void WarmStart::commit(void)
+{
+	warmCrc = crc();
+}
+
+uint8_t WarmStart::resetCause(void) const
+{
+	return resetFlags;
+}
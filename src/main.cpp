@@ -44,85 +44,157 @@
 #include <cactus_io_BME280_I2C.h>
 #include <OneWire.h>
 #include <DallasTemperature.h>
+#include "TempBuses.h"      // Concurrent conversions across the DS18B20 buses
+#include "PulseCounter.h"   // Hardware counting of anemometer pulses (WIND_COUNT_HW)
+#include "RainLog.h"        // Per-tip timestamps for peak rainfall intensity
+#include "SampleClock.h"    // Timer1 disciplined to the RTC 1Hz output (TIMER_DISCIPLINED)
+#include "StationClock.h"   // Monotonic 0.5s station time for stamping reports, tips & gusts
+#include "ObsPayload.h"     // obsSet & trailers sent to TTN
+#include "ReportFilter.h"   // Change-driven reporting - skip reports that are within deadband
+#include "TxPlanner.h"      // Airtime budget, batching & payload variant for each uplink
+#include "RuntimeConfig.h"  // Settings changed by downlink, kept in EEPROM
+#include "EepromMap.h"
+#include "LoraSession.h"    // OTAA session restored from EEPROM after a reset (LORA_OTAA)
+#include "StationConfig.h"  // Constants derived from the timing defines & sensor set, checked at compile time
+#include "SpscRing.h"       // Lock-free hand over of samples from isr_timer to loop()
+#include "VaneAdc.h"        // Wind vane oversampled by the ADC in the background
+#include "VaneTable.h"      // VANE_TABLE_OFFSET, the offset calibrated into the vane table
+#include "WarmStart.h"      // Watchdog, and state kept over a reset in .noinit RAM
+#include "BootProfile.h"    // Time spent in each stage of setup(), printed at the first sample
 
 #include "TimerOne.h"     // Timer Interrupt set to 2.5 sec for read sensors
 #include <math.h>
-#include <Wire.h>         // For accessing RTC
+#include <TwiEngine.h>    // Interrupt-driven I2C for the RTC & BME280 (in place of Wire)
 #include <SD2405RTC.h>    // For Gravity RTC breakout board.   Set RTC to UTC time
 #include <TimeLib.h>      // For epoch time en/decode
 #include <Timezone.h>	  // For AU Eastern STD/DST so that daily readings are 24hr to 9am (local)
+#include "LocalClock.h"   // Cached UTC offset - Timezone rules only re-read at DST changes
 
 // Sensor-related definitions
 // Set hardware pin assignments & pre-set constants
 #define TX_Pin 4 				   // used to indicate web data tx
 #define ONE_WIRE_BUS_PIN 29 	  //Data bus pin for DS18B20's
+//#define ONE_WIRE_AUX_PIN 31	  // Uncomment when the soil & screen DS18B20's are fitted on their own bus
+#define Has_Barometer  true		// BME280 humidity & pressure.  false compiles the driver out
 
 #define WindSensor_Pin (18)       //The pin location of the anemometer sensor
 #define WindVane_Pin  (A13)       // The pin connecting to the wind vane sensor
-#define VaneOffset  0		   // The anemometer offset from magnetic north
+#define VaneOffset  VANE_TABLE_OFFSET	// The anemometer offset from magnetic north (default) - set by tools/vane_table.py --offset
 #define Bucket_Size  0.2 	   // mm bucket capacity to trigger tip count
 #define RG11_Pin  19        		 // Interrupt pin for rain sensor
 #define BounceInterval  15		// Number of ms to allow for debouncing
 #define SampleInt_Pin   3		// Interrupt pin for RTC-generated sampling clock (when used)
+#define AirTempResolution  12	// DS18B20 bits of resolution (air temp) (default)
+#define CaseTempResolution 10	// DS18B20 bits of resolution (station case temp) (default)
+#define AirAlarmHigh   125		// DS18B20 TH/TL alarm bytes (°C).  Full range = no alarm
+#define AirAlarmLow    -55
+#define CaseAlarmHigh   60		// Case over-temperature alarm
+#define CaseAlarmLow   -55
+
+// Change-driven reporting defaults (x10 units as in obsSet).  Report_Heartbeat 0 sends every report;
+// e.g. 11 sends at least hourly, and otherwise only when a channel moves by its deadband
+#define Report_Heartbeat   0
+#define TempDeadband      5		// 0.5 °C
+#define PressDeadband     5		// 0.5 hPa
+#define HumidDeadband    30		// 3 %
+#define WindDeadband     30		// 3 km/h
+#define RainDeadband      2		// one bucket tip (0.2mm)
+#define GustSpike       100		// 10 km/h rise in gust - sent at once
+#define Report_Redundancy  0	// earlier reports echoed in each uplink (0-2) - recovers lost frames
 
 // Set timer related settings for sensor sampling & calculation
+// Sample_Interval, Report_Interval, VaneOffset & the DS18B20 resolutions are defaults, which a
+// downlink can change at runtime (see RuntimeConfig.h)
 #define Timing_Clock  500000    //  0.5sec in millis
 #define Sample_Interval   5		//  = number of Timing_Clock cycles  i.e. 2.5sec interval
 #define Report_Interval   120    //  = number of sample intervals contributing to each upload report (each 5 min)
-#define Speed_Conversion  1.4481   // convert rotations to km/h.  = 2.25/(Sample_Interval x Timing_Clock)* 1.609 
-									// refer Davis anemometer technical spec
+#define Davis_Conversion  3.62025	// km/h per rotation/sec = 2.25 * 1.609   refer Davis anemometer technical spec
+#ifdef ONE_WIRE_AUX_PIN
+typedef StationConfig<Timing_Clock, Sample_Interval, Report_Interval, Has_Barometer, 2> Station;
+#else
+typedef StationConfig<Timing_Clock, Sample_Interval, Report_Interval, Has_Barometer, 1> Station;
+#endif
+// Wind speed is kept in km/h x 10 throughout.  This is the speed from one rotation in one Timing_Clock
+// tick, as a Q16 fixed point constant worked out by the compiler; divided by the sample interval once
+// per config change, it leaves the ISR a single integer multiply per sample
+constexpr uint32_t WindX10PerRotTick_Q16 = Station::windX10PerRotTickQ16(Davis_Conversion);
+static_assert(WindX10PerRotTick_Q16 <= 0xFFFFFFFFUL / 100, "wind speed must not overflow below 100 rotations per tick");
+static_assert(Station::ticksPerSec == STATION_TICKS_PER_SEC, "StationClock ticks must match Timing_Clock");
 //#define TIMER_FROM_RTC 1		// Uncomment this line if timing clock for sampler drawn from RTC frequency interrupt
+//#define TIMER_DISCIPLINED 1	// Uncomment to keep Timer1 phase-locked to the RTC 1Hz interrupt on SampleInt_Pin
+//#define WIND_COUNT_HW 1		// Uncomment if anemometer is wired (via RC filter) to T5, pin 47, for hardware counting
+//#define EOD_ALARM 1			// Uncomment to also arm the RTC alarm (INT on SampleInt_Pin) for the daily rollover
+//#define LORA_OTAA 1			// Uncomment to join by OTAA (keys below) instead of the ABP session
+//#define FAST_BOOT 1			// Uncomment to skip the serial waits & take the first sample one tick after boot (not counted in the first report)
+//#define I2C_FAST 1			// Uncomment to run I2C at 400kHz (BME280 & SD2405 both allow it) if the wiring is short
+#if defined(TIMER_FROM_RTC) + defined(TIMER_DISCIPLINED) + defined(EOD_ALARM) > 1
+#error "TIMER_FROM_RTC, TIMER_DISCIPLINED and EOD_ALARM all use the RTC interrupt - choose one"
+#endif
 									
-volatile bool isSampleRequired;    		// set true every Sample_Interval.   Get wind speed
+StationSettings settings;				// settings in force - downlinked changes start at a report boundary
+uint32_t speedFactorQ16;				// rotations per sample -> km/h x 10, Q16.  = WindX10PerRotTick_Q16 / sample interval
+float reportIntervalSec;
+
+// One sample interval's wind readings, queued by isr_timer.  Samples wait here while loop() is
+// busy (LMIC, Serial, sensor reads), so none is lost and every one is checked for gusts
+typedef struct SensorSample {
+	uint16_t	rotations;		// anemometer rotations in the interval
+	uint16_t	vane;			// mean wind vane ADC reading over the interval
+	stamp_t		stamp;			// station time the interval completed
+	uint8_t		ticks;			// Timing_Clock ticks covered - the sample interval, except at boot
+ } SensorSample;
+#define SAMPLE_QUEUE_SIZE  8			// 7 samples (17.5s at 2.5s) of slack for loop()
+SpscRing<SensorSample, SAMPLE_QUEUE_SIZE> sampleRing;	// overflows() counts samples lost
+VaneAdc vaneAdc;						// ~976 vane readings a second, averaged per sample
+
 volatile unsigned int timerCount;  		// used to determine when Sample_Interval is reached
+volatile uint8_t sampleTicks;			// length of the sample in progress (settings.sampleInterval)
 volatile unsigned int sampleCount;		// used to determin when Report_Interval is reached
+unsigned int reportStartCount;			// sampleCount at an urgent report part way through the cycle, else 0
 volatile unsigned long rotations;  		// cup rotation counter for wind speed calcs
 volatile unsigned long contactBounceTime;  // Timer to avoid contact bounce in wind speed sensor
-volatile float windSpeed, windGust;        // speed in km per hour
+uint16_t windGustX10;					// highest sample this report period
+StationClock stationClock;				// Timing_Clock ticks since boot, mapped to UTC
+stamp_t gustStamp;						// station time of the sample holding the gust record
+#ifdef TIMER_DISCIPLINED
+SampleClock sampleClock;				// trims Timer1 against the RTC so reports stay on UTC boundaries
+bool alignPending;						// locked, report phase not yet aligned (RTC read failed)
+#endif
+#ifdef WIND_COUNT_HW
+PulseCounter5 windCounter;				// anemometer pulses counted by Timer5, read once per sample
+#endif
 
 volatile unsigned long tipCount;  	 	// rain bucket tipcounter used in interrupt routine
 volatile unsigned long contactTime; 	// timer to manage contact bounce in interrupt routine
 volatile unsigned long obsRainfallCount; // total count of rainfall tips recorded in observatoin period (5min)
 volatile float obsReportRainfallRate;    	// total amount of rainfall in the reporting period  (5 min)
 volatile unsigned long dailyRainfallCount;	//  total count of rainfall tips in 24 hrs to 9am (local time)
-const float reportIntervalSec = Report_Interval * Sample_Interval * float(Timing_Clock) / 1000000;
-
-// Define structures for handling reporting via TTN
-typedef struct obsSet {
-	uint16_t 	windGustX10; // observed windgust speed (km/h) X10  ~range 0 -> 1200
-	uint16_t	windGustDir; // observed wind direction of Gust (compass degrees)  0 -> 359
-	uint16_t	tempX10;	// observed temp (°C) +100 x 10   ~range -200->600
-	uint16_t	humidX10;	// observed relative humidty (%) x 10   range 0->1000
-	uint16_t 	pressX10;	// observed barometric pressure at station level (hPa)  x 10  ~range 8700 -> 11000 
-	uint16_t	rainflX10;	// observed accumulated rainfall (mm) x10   ~range 0->1200
-	uint16_t	windspX10;	// observed windspeed (km/h) x10 ~range 0->1200
-	uint16_t	windDir;	// observed wind direction (compass degrees)  range 0->359
-	uint16_t	dailyRainX10; //  accumulated rainfall (mm) X10 for period to 9am daily
-	uint16_t	casetempX10;		// station case temperature (for alarming)
- } obsSet;
-		
-union obsPayload
-{
-	obsSet	obsReport;
-	uint8_t	readAccess[sizeof(obsSet)];
-}sensorObs[2];
+RainLog rainLog;							// timestamp of every tip, for peak 1-minute intensity
+
+// Define structures for handling reporting via TTN (obsSet etc. are in ObsPayload.h)
+obsPayload sensorObs;					// report being prepared - completed reports are queued in txPlanner
+uint8_t obsLength;			// bytes of sensorObs to transmit
+TxPlanner txPlanner(sizeof(obsSet));
 
 // AU Eastern Time Zone (Sydney, Melbourne)   Use next 3 lines for one time setup to be written to EEPROM
 //TimeChangeRule auEDST = {"AEDT", First, Sun, Oct, 2, 660};    //Daylight time = UTC + 11:00 hours
-//TimeChangeRule auESTD = {"AEST", First, Sun, Apr, 2, 600};     //Standard time = UTC + 10:00 hours
+//TimeChangeRule auESTD = {"AEST", First, Sun, Apr, 3, 600};     //Standard time = UTC + 10:00 hours (from 3am AEDT)
 //Timezone auEastern(auEDST, auESTD);
 
 // If TimeChangeRules are already stored in EEPROM, comment out the three
 // lines above and uncomment the line below.
-Timezone auEastern(100);       // assumes rules stored at EEPROM address 100 & that RTC set to UTC
-TimeChangeRule *tcr;		// pointer to the timechange rule
-time_t utc, localTime;
-boolean	dailyTotalsDue;		// flags that totals for 24hr to 9am local are to be reported & reset
+Timezone auEastern(EEPROM_TZ_RULES);       // assumes rules stored at EEPROM address 100 & that RTC set to UTC
+LocalClock localClock(auEastern);	// tracks the current offset & next DST change
+time_t utc;
+time_t nextEodUtc;			// UTC epoch of the next EOD_HOUR (local) rollover of the daily totals
+#ifdef EOD_ALARM
+volatile boolean eodAlarmFired;	// set by the RTC alarm at nextEodUtc
+#endif
 
-int  currentObs, reportObs;   //References which obsPayload [0 or 1]is being filled vs. reported 
 int vaneValue;         	 	//  raw analog value from wind vane
-int vaneDirection;          //  translated 0-360 direction
-int calDirection, calGustDirn;     	//  converted value with offset applied
+int vaneDirection;          //  calibrated direction, 0-3599 tenths of a degree (includes VaneOffset)
+int vaneTrimX10;			//  downlinked vane offset less VANE_TABLE_OFFSET, tenths
+int calDirection, calGustDirn;     	//  converted value with offset applied, tenths
 const int count = 4;				// average the last 4 wind directions
 int boxcar[count];					// stack of wind direction values for averaging calculation
 const bool BaseRange = true;
@@ -135,12 +207,22 @@ static const PROGMEM u1_t NWKSKEY[16] = { 0x1A, 0x71, 0xFD, 0x1C, 0xFC, 0x99, 0x
 // LoRaWAN AppSKey, application session key
 static const PROGMEM u1_t  APPSKEY[16] = { 0x14, 0xEE, 0x5D, 0xE6, 0x45, 0xDE, 0x42, 0xA1, 0xA7, 0xAA, 0xF9, 0xAF, 0x36, 0x94, 0x90, 0x6E };
 
-//  Create BME280 object
-BME280_I2C bme;     // I2C using address 0x77
+//  Create BME280 object (or its stand-in when Has_Barometer is false)
+StationSelect<Has_Barometer, BME280_I2C, NoBarometer>::type bme;     // I2C using address 0x77
+bool barometerOk;			// BME280 found - otherwise retried at each report
 
-// Setup a oneWire instance to communicate with OneWire devices
-OneWire oneWire(ONE_WIRE_BUS_PIN);
-DallasTemperature DSsensors(&oneWire);    // Pass the OneWire reference to Dallas Temperature lib
+// Setup a oneWire instance for each DS18B20 bus.  Conversions on all buses run concurrently
+OneWire oneWireBus[] = {
+	ONE_WIRE_BUS_PIN,
+#ifdef ONE_WIRE_AUX_PIN
+	ONE_WIRE_AUX_PIN,
+#endif
+};
+const uint8_t oneWireCount = sizeof(oneWireBus) / sizeof(OneWire);
+static_assert(oneWireCount == Station::tempBuses, "Station must be told of every DS18B20 bus");
+DallasTemperature DSsensors[oneWireCount];    // Each bus gets its own Dallas Temperature instance
+TempBuses tempBuses(DSsensors, oneWireCount);
+int8_t airTempProbe, caseTempProbe;			// tempBuses indices of the main bus sensors
 
 // Assign the addresses of the DS18B20 sensors (determined by reading them previously)
 DeviceAddress airTempAddr = { 0x28, 0x1A, 0x30, 0x94, 0x3A, 0x19, 0x01, 0x55 };
@@ -152,21 +234,45 @@ DeviceAddress caseTempAddr = { 0x28, 0xAA, 0x68, 0x93, 0x41, 0x14, 0x01, 0xD8 };
 // The library converts the address to network byte order as needed.
 static const u4_t DEVADDR = 0x26002FB5; // <-- Change this address for every node!
 
+#ifdef LORA_OTAA
+// OTAA credentials from the TTN console.  AppEUI & DevEUI in little-endian (LSB first) byte
+// order, AppKey in big-endian (MSB first) as displayed.
+static const u1_t PROGMEM APPEUI[8] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+static const u1_t PROGMEM DEVEUI[8] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+static const u1_t PROGMEM APPKEY[16] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+										 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+void os_getArtEui (u1_t* buf) { memcpy_P(buf, APPEUI, 8); }
+void os_getDevEui (u1_t* buf) { memcpy_P(buf, DEVEUI, 8); }
+void os_getDevKey (u1_t* buf) { memcpy_P(buf, APPKEY, 16); }
+
+LoraSession loraSession(APPEUI, DEVEUI, APPKEY);	// joined session, kept over resets
+#else
 // These callbacks are only used in over-the-air activation, so they are
 // left empty here (we cannot leave them out completely unless
 // DISABLE_JOIN is set in config.h, otherwise the linker will complain).
 void os_getArtEui (u1_t* buf) { }
 void os_getDevEui (u1_t* buf) { }
 void os_getDevKey (u1_t* buf) { }
+#endif
 
 
 static osjob_t sendjob;
+void do_send(osjob_t* j);
 
 // Schedule TX every this many seconds (might become longer due to duty
 // cycle limitations).
-const unsigned TX_INTERVAL = 300 ;		// 5 min reporting cycle
+const unsigned TX_INTERVAL = Station::reportSec;		// 5 min reporting cycle
+static_assert(Station::reportSec >= MinReportSec, "Sample_Interval x Report_Interval is below the shortest report RuntimeConfig accepts");
 const int EOD_HOUR = 9;			// Daily totals are reset at 9am (local);
 
+RuntimeConfig config({ Sample_Interval, Report_Interval, TX_INTERVAL / 10, AirTempResolution,
+						CaseTempResolution, VaneOffset, TxVariant_Auto,
+						{ Report_Heartbeat, TempDeadband, PressDeadband, HumidDeadband,
+						  WindDeadband, RainDeadband, GustSpike }, Report_Redundancy }, Station::tickUs);
+ReportFilter reportFilter;		// decides which reports are worth sending
+WarmStart warmStart;			// checkpoint taken after every batch of samples
+BootProfile bootProfile;
+
 // Pin mapping
 // TL Modifications:
 // Specifically for Arduino Uno/Mega + Dragino LoRa Shield US900
@@ -177,6 +283,19 @@ const lmic_pinmap lmic_pins = {
     .dio = {2, 6, 7},
 };
 
+#ifdef LORA_OTAA
+static osjob_t rejoinjob;
+
+// Drop the dead session and join again - run as a job, outside LMIC's event callback
+void do_rejoin(osjob_t* j) {
+	LMIC_unjoin();
+	#if defined(CFG_us915) || defined(CFG_au915)
+		LMIC_selectSubBand(1);		// unjoin restores the default channel plan
+	#endif
+	LMIC_startJoining();
+}
+#endif
+
 void onEvent (ev_t ev) {
     Serial.print(os_getTime());
     Serial.print(": ");
@@ -198,6 +317,10 @@ void onEvent (ev_t ev) {
             break;
         case EV_JOINED:
             Serial.println(F("EV_JOINED"));
+			#ifdef LORA_OTAA
+				LMIC_setLinkCheckMode(0);
+				loraSession.save();			// a reset now restores this session rather than rejoining
+			#endif
             break;
         /*
         || This event is defined but not used in the code. No
@@ -221,10 +344,25 @@ void onEvent (ev_t ev) {
               Serial.println(F("Received "));
               Serial.println(LMIC.dataLen);
               Serial.println(F(" bytes of payload"));
+              if ((LMIC.dataBeg > 0) && (LMIC.frame[LMIC.dataBeg - 1] == ConfigPort)) {
+                if (config.handleDownlink(&LMIC.frame[LMIC.dataBeg], LMIC.dataLen))
+                  Serial.println(F("Configuration saved - applies from next report"));
+                else
+                  Serial.println(F("Configuration unchanged or rejected"));
+              }
             }
 			digitalWrite(TX_Pin, LOW);		// Tx/Rx LED off
+			#ifdef LORA_OTAA
+				loraSession.checkpoint();	// keep the saved frame counter close behind LMIC's
+			#endif
+			Serial.print(F("Airtime used/remaining (ms, 24hr): "));
+			Serial.print(txPlanner.usedMs(now()));
+			Serial.print(F(" / "));
+			Serial.println(txPlanner.remainingMs(now()));
             // Schedule next transmission - move next line to schedule in loop(), to stay in sync with sensors
 //            os_setTimedCallback(&sendjob, os_getTime()+sec2osticks(TX_INTERVAL), do_send);
+			if (txPlanner.pending())		// a backlog drains as the budget allows, not one per report
+				os_setCallback(&sendjob, do_send);
 			break;
         case EV_LOST_TSYNC:
             Serial.println(F("EV_LOST_TSYNC"));
@@ -238,6 +376,10 @@ void onEvent (ev_t ev) {
             break;
         case EV_LINK_DEAD:
             Serial.println(F("EV_LINK_DEAD"));
+			#ifdef LORA_OTAA
+				loraSession.forget();		// the network no longer answers - rejoin now, and not
+				os_setCallback(&rejoinjob, do_rejoin);	// restore this session after a reset
+			#endif
             break;
         case EV_LINK_ALIVE:
             Serial.println(F("EV_LINK_ALIVE"));
@@ -268,30 +410,80 @@ void do_send(osjob_t* j){
     if (LMIC.opmode & OP_TXRXPEND) {
         Serial.println(F("OP_TXRXPEND, not sending"));
     } else {
-        // Prepare upstream data transmission at the next possible time.
-        LMIC_setTxData2(1, sensorObs[reportObs].readAccess, sizeof(obsSet), 0);     // Use the last completed set of obs
-        Serial.println(F("Packet queued"));
-        Serial.print(F("Sending packet on frequency: "));
-        Serial.println(LMIC.freq);
+        // Prepare upstream data transmission at the next possible time - if the airtime budget allows
+        time_t t = now();
+        if (txPlanner.plan(t, LMIC.datarate)) {
+            if (LMIC_setTxData2(txPlanner.framePort(), txPlanner.frame(), txPlanner.frameLength(), 0) == LMIC_ERROR_SUCCESS) {
+                txPlanner.sent(t);      // only charged & released once LMIC has the frame
+                Serial.println(F("Packet queued"));
+                Serial.print(F("Sending packet on frequency: "));
+                Serial.println(LMIC.freq);
+            } else
+                Serial.println(F("LMIC rejected the frame - reports held"));
+        } else if (txPlanner.pending()) {
+            uint32_t retrySec = txPlanner.retryInSec(t, LMIC.datarate);
+            Serial.print(txPlanner.pending());
+            Serial.print(F(" reports held for airtime budget - retry in (s) "));
+            Serial.println(retrySec);
+            os_setTimedCallback(&sendjob, os_getTime()+sec2osticks(retrySec), do_send);
+        }
     }
-    // Next TX is scheduled after TX_COMPLETE event.
+    // Next TX is scheduled after TX_COMPLETE event, while reports are held
 }
 
 
 // Interrupt handler routine for timer interrupt
 void isr_timer() {
 	
+	#ifdef TIMER_DISCIPLINED
+		sampleClock.tick();
+	#endif
+	stationClock.tick();
 	timerCount++;
 
-	if(timerCount == Sample_Interval) {
-		// convert to km/h using the formula V=P(2.25/T)*1.609 where T = sample interval
-		// i.e. V = P(2.25/2.5)*1.609 = P * Speed_Conversion factor  (=1.4481  for 2.5s interval)
-		windSpeed = rotations * Speed_Conversion; 
+	if(timerCount >= sampleTicks) {
+		#ifdef WIND_COUNT_HW
+			rotations = windCounter.delta();	// pulses counted in hardware over this interval
+		#endif
+		SensorSample sample = { (uint16_t)rotations, vaneAdc.take(), stationClock.nowISR(), (uint8_t)timerCount };
+		sampleRing.push(sample);			// dropped & counted only if loop() is a full queue behind
 		rotations = 0;   
-		isSampleRequired = true;
 		timerCount = 0;						// Restart the interval count
+		sampleTicks = settings.sampleInterval;
+	}
+}
+
+#ifdef TIMER_DISCIPLINED
+// Interrupt handler for the RTC 1Hz frequency interrupt - the discipline reference
+void isr_rtcSecond() {
+	sampleClock.rtcEdge();
+}
+
+// Once Timer1 is locked to RTC seconds, set the sample & report counters so that reports
+// complete on whole multiples of the report interval in UTC.  The lock counters, station clock &
+// sample counters are read and set together; false (try again) if the RTC read failed or an RTC
+// second passed while it was read
+bool alignReportPhase() {
+	unsigned long secondsBefore = sampleClock.secondsSinceLock();
+	time_t utc = RTC.get();
+	unsigned long seconds, lockTicks;
+	noInterrupts();
+	sampleClock.sinceLockISR(seconds, lockTicks);
+	if ((utc == 0) || (seconds != secondsBefore)) {
+		interrupts();
+		return false;
 	}
+	unsigned long lockSecond = utc - seconds;
+	unsigned long ticks = (lockSecond % (unsigned long)reportIntervalSec) * Station::ticksPerSec + lockTicks;
+	stamp_t lockStamp = stationClock.nowISR() - lockTicks;
+	timerCount = ticks % settings.sampleInterval;
+	sampleCount = (ticks / settings.sampleInterval) % settings.reportInterval;
+	interrupts();
+	stationClock.sync(lockSecond, lockStamp);
+	reportStartCount = 0;
+	return true;
 }
+#endif
 
 // Interrupt handler routine to increment the rotation count for wind speed
 void isr_rotation ()   {
@@ -308,6 +500,7 @@ void isr_rg ()   {
    if ((millis() - contactTime) > BounceInterval ) {  // debounce of sensor signal
       tipCount++;
       contactTime = millis();
+      rainLog.tip(stationClock.nowISR());
    } 
 } 
 
@@ -326,25 +519,22 @@ int average(int value)
   return sum/count;
 }
 
-// Get Wind Direction
+// Get Wind Direction (from the vaneValue of the current sample)
 void getWindDirection(bool baseRange) {
 	static int recentAvgDirn = 0;		// average of last 3 adjusted measurements
 	int altReading, deltaAsRead, deltaExtd;		// candidate alternative to raw direction measurement
 	
 	if (baseRange) {		// take a reading in standard 0-360 deg. range
-		vaneValue = analogRead(WindVane_Pin);
-		vaneDirection = map(vaneValue, 0, 1023, 0, 359);
-		calDirection = vaneDirection + VaneOffset;
-		if(calDirection > 360)
-			calDirection = calDirection - 360;
+		vaneDirection = VaneAdc::bearingX10(vaneValue);
+		calDirection = ((vaneDirection + vaneTrimX10) % 3600 + 3600) % 3600;
 		return;			// returns value via calDirection
 	}   
 	
 	// Here (baseRange is FALSE) we find if +/- 360 gives a reading closer to the most recent wind direction
 	// Does not take a new direction reading - uses the last one 
 	// This averaging is only invoked for directions included in the 5 min reports
-	if (calDirection > 270) altReading	= calDirection - 360;
-	else if (calDirection < 90) altReading = calDirection + 360;
+	if (calDirection > 2700) altReading	= calDirection - 3600;
+	else if (calDirection < 900) altReading = calDirection + 3600;
 	else altReading = calDirection;
 	
 	deltaAsRead = abs(calDirection - recentAvgDirn);
@@ -355,6 +545,15 @@ void getWindDirection(bool baseRange) {
 	recentAvgDirn = average(calDirection);
 }
 
+// Convert a DS18B20 raw reading (1/128 °C) to the payload encoding (°C + 100) x 10, rounded to
+// nearest.  Integer only; a disconnected sensor maps to TempX10_Disconnected
+uint16_t tempRawToX10(int16_t raw) {
+	if (raw == DEVICE_DISCONNECTED_RAW)		// the library's sentinel exactly - a reading below it is still a reading
+		return TempX10_Disconnected;
+	// raw + 100°C is always positive in the sensor range (-55 -> 125°C), so a shift rounds correctly
+	return ((uint32_t)(raw + 100 * 128) * 10 + 64) >> 7;
+}
+
 // Field format utility for printing
 void print2digits(int number)  {
 	if (number >= 0 && number <10) {
@@ -363,32 +562,66 @@ void print2digits(int number)  {
 	Serial.print(number);
 }
 
-// Check if a report is the last of a daily sequence.  Relies on window open +/- 1hr 
-//  either side of EOD_HOUR
-boolean resetDaily(time_t localTime, int windowOpensHr, int windowClosesHr) {
-	int checkHour = hour(localTime);
-	if ((checkHour < windowOpensHr) || (checkHour >= windowClosesHr)) {
-		dailyTotalsDue = true;
-		return false; 		// Outside the reset time window
-	}
-	if (dailyTotalsDue) {
-		if (checkHour == EOD_HOUR) {
-			dailyTotalsDue = false;
-			return true;
-		}
-		if ((minute(localTime) + TX_INTERVAL/60) < 60 ) {
-			dailyTotalsDue = true;
-			return false;    // Next report will still be ahead of EOD_HOUR
-		}
-		else {
-			dailyTotalsDue = false;
-			return true;	//  Next report period should start from zero daily totals
-		}
-	}
-	else return false;
+// Work out when the daily totals next roll over.  A report ending within half a report
+// interval of the boundary is the last of the day, so the search starts from there
+void scheduleDailyReset(time_t utc) {
+	nextEodUtc = localClock.nextLocalHour(utc + (time_t)reportIntervalSec / 2, EOD_HOUR);
+	#ifdef EOD_ALARM
+		tmElements_t al;
+		breakTime(nextEodUtc, al);
+		al.Year = tmYearToY2k(al.Year);		// writeAlarm takes years since 2000
+		eodAlarmFired = false;
+		RTC.writeAlarm(al, false, true);	// single date alarm - also clears the previous alarm flag
+	#endif
+}
+
+#ifdef EOD_ALARM
+// Interrupt handler for the RTC alarm at the daily rollover
+void isr_eodAlarm() {
+	eodAlarmFired = true;
 }
+#endif
 				
 
+// Bring DS18B20 resolution & alarm bytes (and the RTC frequency interrupt, when used) to the
+// wanted settings.  Only differences are written, so a normal boot does no EEPROM writes.
+// (The BME280 control registers are synced the same way inside bme.begin())
+void syncSensorConfig() {
+	if (!DSsensors[0].syncScratchPad(airTempAddr, settings.airResolution, AirAlarmHigh, AirAlarmLow))
+		Serial.println(F("Air temp DS18B20 not responding"));
+	if (!DSsensors[0].syncScratchPad(caseTempAddr, settings.caseResolution, CaseAlarmHigh, CaseAlarmLow))
+		Serial.println(F("Case temp DS18B20 not responding"));
+	#if defined(TIMER_FROM_RTC)
+		RTC.syncFreqInt(SD2405_FREQ_2HZ);		// 2Hz => Timing_Clock of 0.5s
+	#elif defined(TIMER_DISCIPLINED)
+		RTC.syncFreqInt(SD2405_FREQ_1HZ);		// 1Hz reference for Timer1 discipline
+	#endif
+}
+
+// Take up the RuntimeConfig settings - at boot, then at report boundaries so that no sample or
+// report period is cut short - and derive the dependent values.  The sensors are configured at
+// boot, and after that only when a resolution changes
+void applyConfig(bool boot) {
+	StationSettings s = config.take();
+	bool resolutionChanged = (s.airResolution != settings.airResolution)
+								|| (s.caseResolution != settings.caseResolution);
+	noInterrupts();
+	settings = s;
+	sampleTicks = s.sampleInterval;
+	interrupts();
+	speedFactorQ16 = WindX10PerRotTick_Q16 / s.sampleInterval;
+	vaneTrimX10 = (s.vaneOffset - VaneAdc::tableOffset()) * 10;
+	reportIntervalSec = (float)s.reportInterval * s.sampleInterval / Station::ticksPerSec;
+	txPlanner.setInterval((uint16_t)reportIntervalSec);
+	txPlanner.setVariant(s.payloadVariant);
+	txPlanner.setRedundancy(s.redundancy);
+	reportFilter.setDeadbands(s.deadbands);
+	if (boot || resolutionChanged) {
+		syncSensorConfig();
+		tempBuses.begin();			// re-reads resolution for the conversion wait
+	}
+}
+
 // Print utility for packed structure
 void printIt(uint8_t *charArray, int length) {
   int i;
@@ -401,25 +634,69 @@ void printIt(uint8_t *charArray, int length) {
 	Serial.println("===EndOfBuffer========");
 }
 
+// Save what a reset must not lose (see WarmStart.h)
+void checkpointState() {
+	WarmState &w = warmStart.state();
+	noInterrupts();
+	w.tipCount = tipCount;
+	interrupts();
+	w.dailyRainfallCount = dailyRainfallCount;
+	w.nextEodUtc = nextEodUtc;
+	w.sampleCount = sampleCount;
+	w.reportStartCount = reportStartCount;
+	w.windGustX10 = windGustX10;
+	w.calGustDirn = calGustDirn;
+	w.obsCount = txPlanner.held(w.obs, WARM_OBS_MAX);
+	txPlanner.budget(w.budget);
+	warmStart.commit();
+}
+
+// Carry on from the last checkpoint.  Samples since then are lost, the current gust is
+// restamped & any daily rollover that fell while the station was down runs at the next report
+void restoreState() {
+	const WarmState &w = warmStart.state();
+	tipCount = w.tipCount;
+	dailyRainfallCount = w.dailyRainfallCount;
+	nextEodUtc = w.nextEodUtc;
+	sampleCount = w.sampleCount;
+	reportStartCount = w.reportStartCount;	// rain rate is over the time since an urgent report
+	windGustX10 = w.windGustX10;
+	calGustDirn = w.calGustDirn;
+	gustStamp = stationClock.now();
+	txPlanner.restore(w.obs, w.obsCount);
+	txPlanner.restoreBudget(w.budget);
+}
+
 void setup() {
 	
-	while (!Serial); // wait for Serial to be initialized
+	warmStart.arm();				// from here a lockup resets the station
+	bool warm = warmStart.restore();
+	#ifndef FAST_BOOT
+	if (!warm) {
+		while (!Serial); // wait for Serial to be initialized
+	}
+	#endif
 	Serial.begin(115200);
-	delay(500);     
+	#ifdef I2C_FAST
+		Twi.setClock(TWI_FAST);
+	#endif
+	#ifndef FAST_BOOT
+	if (!warm)
+		delay(500);     
+	#endif
+	bootProfile.mark(F("serial"));
 	
+	RTC.begin();
 	setSyncProvider(RTC.get);
 	setSyncInterval(500);     // resync system time to RTC every 500 sec
+	bootProfile.mark(F("RTC"));
 
 
-	// prepare obsPayload selection indices
-	currentObs = 0;
-	reportObs = 1;
-	dailyTotalsDue = true;
+	stationClock.sync(now(), stationClock.now());	// whole seconds only until TIMER_DISCIPLINED locks
   
 	// initialise anemometer values
 	rotations = 0;
-	isSampleRequired = false;
-	windGust = 0;
+	windGustX10 = 0;
 	calGustDirn = 0;
   
 	// setup RG11 rain totals & conversion factor
@@ -430,15 +707,36 @@ void setup() {
 	// setup timer values
 	timerCount = 0;
 	sampleCount = 0;
+	reportStartCount = 0;
 	
   
-	// Initialise the Temperature measurement library & set sensor resolution to 12 (10) bits
-	DSsensors.setResolution(airTempAddr, 12);
-	DSsensors.setResolution(caseTempAddr, 10);
+	// Initialise the Temperature measurement library & bring sensor configuration up to date
+	for (uint8_t i = 0; i < oneWireCount; i++)
+		DSsensors[i].setOneWire(&oneWireBus[i]);
+	if (!config.begin())
+		Serial.println(F("No saved configuration - using defaults"));
+	applyConfig(true);				// also syncs the sensor configuration & starts tempBuses
+	scheduleDailyReset(now());
+	airTempProbe = tempBuses.addProbe(0, airTempAddr);
+	caseTempProbe = tempBuses.addProbe(0, caseTempAddr);
  
-	if (!bme.begin())  {    
+	barometerOk = bme.begin();
+	if (!barometerOk)
       Serial.println("Could not find BME280 sensor -  check wiring");
-     while (1);
+	#ifdef FAST_BOOT
+		tempBuses.requestTemperatures();	// first conversion runs while LMIC & the radio initialise
+	#endif
+	bootProfile.mark(F("config & sensors"));
+
+	if (warm) {
+		restoreState();
+		Serial.print(F("Warm start - reset cause "));
+		if (warmStart.resetCause()) {
+			Serial.print(F("0x"));
+			Serial.println(warmStart.resetCause(), HEX);
+		}
+		else
+			Serial.println(F("unknown (cleared by the bootloader)"));
 	}
 
 	
@@ -454,9 +752,17 @@ void setup() {
 	pinMode(WindSensor_Pin, INPUT);
 	pinMode(RG11_Pin, INPUT);
 
-	attachInterrupt(digitalPinToInterrupt(WindSensor_Pin), isr_rotation, FALLING);
+	#ifdef WIND_COUNT_HW
+		windCounter.begin();
+	#else
+		attachInterrupt(digitalPinToInterrupt(WindSensor_Pin), isr_rotation, FALLING);
+	#endif
 	attachInterrupt(digitalPinToInterrupt(RG11_Pin),isr_rg, FALLING);
+	vaneAdc.begin(WindVane_Pin - A0);
 	
+	#ifdef FAST_BOOT
+		sampleTicks = 1;			// first sample after one tick - its wind speed is scaled to suit
+	#endif
 	//Setup the timer for 0.5s
 	#ifdef TIMER_FROM_RTC
 		// For RTC-generated clock timer
@@ -466,14 +772,26 @@ void setup() {
 		// timer drawn from internal MCU Timer1 interrupt
 		Timer1.initialize(Timing_Clock);     
 		Timer1.attachInterrupt(isr_timer);
+		#ifdef TIMER_DISCIPLINED
+			sampleClock.begin(Timing_Clock);
+			pinMode(SampleInt_Pin, INPUT_PULLUP);
+			attachInterrupt(digitalPinToInterrupt(SampleInt_Pin), isr_rtcSecond, FALLING);
+		#endif
+		#ifdef EOD_ALARM
+			pinMode(SampleInt_Pin, INPUT_PULLUP);
+			attachInterrupt(digitalPinToInterrupt(SampleInt_Pin), isr_eodAlarm, FALLING);
+		#endif
 	#endif
    
+	bootProfile.mark(F("pins & timer"));
+
     // LMIC init
     os_init();
 		
     // Reset the MAC state. Session and pending data transfers will be discarded.
     LMIC_reset();
 
+  #ifndef LORA_OTAA
     // Set static session parameters. Instead of dynamically establishing a session
     // by joining the network, precomputed session parameters are be provided.
     #ifdef PROGMEM
@@ -489,6 +807,7 @@ void setup() {
 		// If not running an AVR with PROGMEM, just use the arrays directly
 		LMIC_setSession (0x13, DEVADDR, NWKSKEY, APPSKEY);
     #endif
+  #endif
 
     #if defined(CFG_eu868)
     // Set up the channels used by the Things Network, which corresponds
@@ -528,15 +847,27 @@ void setup() {
     // Disable link check validation
     LMIC_setLinkCheckMode(0);
 
+  #ifdef LORA_OTAA
+	// Pick up the session saved after the last join (after the region setup above, as it
+	// carries the channel mask).  Otherwise join now, ready for the first report.
+	if (loraSession.restore())
+		Serial.println(F("Restored OTAA session"));
+	else {
+		Serial.println(F("No saved OTAA session - joining"));
+		LMIC_startJoining();
+	}
+  #else
     // TTN uses SF9 for its RX2 window.
     //LMIC.dn2Dr = DR_SF9;
 	LMIC.dn2Dr = DR_SF7CR;    //** now uses SF7 
 
     // Set data rate and transmit power for uplink (note: txpow seems to be ignored by the library)
     LMIC_setDrTxpow(DR_SF7,14);
+  #endif
 
     // Start job
     do_send(&sendjob);
+	bootProfile.mark(F("LMIC"));
 		
 	sei();   // Enable Interrupts
 	
@@ -544,60 +875,136 @@ void setup() {
 
 void loop() {
 
-	if(isSampleRequired) {
-		sampleCount++;
-		DSsensors.requestTemperatures();    // Read temperatures from all DS18B20 devices
-		bme.readSensor();					// Read humidity & barometric pressure
-	
-		getWindDirection(BaseRange);			//  Read dirn in range 0 - 360 deg.
+	warmStart.feed();
+	SensorSample sample;
+	bool sampled = !sampleRing.isEmpty();
+	if (sampled) {			// once per batch - samples queued while loop() was busy share these
+		tempBuses.requestTemperatures();    // Start conversions on all DS18B20 buses - harvested below
+		if (barometerOk)
+			bme.requestSensor();				// Read humidity & barometric pressure in the background
+	}
+
+	while (sampleRing.pop(sample)) {
+		bool shortSample = (sample.ticks < settings.sampleInterval);	// first sample after a FAST_BOOT
+		if (!shortSample)
+			sampleCount++;					// a short sample is not counted toward the report
+		vaneValue = sample.vane;
+		getWindDirection(BaseRange);			//  Dirn in range 0 - 3599 tenths of a deg.
 		
-		if (windSpeed > windGust) {      // Check last sample of windspeed for new Gust record
-			windGust = windSpeed;
+		// convert to km/h using the formula V=P(2.25/T)*1.609 where T = sample interval
+		// i.e. V = P(2.25/2.5)*1.609 = 1.4481 P for 2.5s interval - here in km/h x 10, rounded
+		uint32_t factorQ16 = (sample.ticks == settings.sampleInterval) ? speedFactorQ16
+								: WindX10PerRotTick_Q16 / sample.ticks;
+		uint16_t sampleSpeedX10 = (sample.rotations * factorQ16 + 0x8000) >> 16;
+		// Check each sample of windspeed for new Gust record - a gust is held over a full sample
+		if (!shortSample && (sampleSpeedX10 > windGustX10)) {
+			windGustX10 = sampleSpeedX10;
 			calGustDirn = calDirection;
+			gustStamp = sample.stamp;
 		}
 			
 
 	//  Does this sample complete a reporting cycle?   If so, prepare payload.
-		if (sampleCount == Report_Interval) {
-			obsRainfallCount = tipCount - dailyRainfallCount;
-			dailyRainfallCount = tipCount;
+	//  Rain onset or a gust spike (change-driven reporting) makes a report now, part way through
+	//  An urgent report needs a sample counted since the last one, or its rain rate has no period
+		noInterrupts();
+		unsigned long tips = tipCount;		// one snapshot of the ISR's count for this sample
+		interrupts();
+		bool reportDue = (sampleCount >= settings.reportInterval);
+		bool urgentNow = !reportDue && (sampleCount != reportStartCount)
+							&& reportFilter.urgent(tips != dailyRainfallCount, windGustX10);
+		if (reportDue || urgentNow) {
+			float periodSec = reportIntervalSec * (sampleCount - reportStartCount) / settings.reportInterval;
+			obsRainfallCount = tips - dailyRainfallCount;
+			dailyRainfallCount = tips;
 			getWindDirection(ExtdRange);	// Update direction to reflect recent average in {-90 to 450 deg}
 			
-			obsReportRainfallRate = obsRainfallCount * Bucket_Size * 3600 / reportIntervalSec;   //  mm/hr
-			sensorObs[currentObs].obsReport.windGustX10 = windGust * 10.0;
-			sensorObs[currentObs].obsReport.windGustDir = calGustDirn;
-			sensorObs[currentObs].obsReport.tempX10 = (DSsensors.getTempC(airTempAddr)+ 100.0)* 10.0;
-			sensorObs[currentObs].obsReport.humidX10 = bme.getHumidity()*10.0;
-			sensorObs[currentObs].obsReport.pressX10 = bme.getPressure_MB()*10.0;
-			sensorObs[currentObs].obsReport.rainflX10 = obsReportRainfallRate * 10.0;
-			sensorObs[currentObs].obsReport.windspX10 = windSpeed * 10.0;
-			sensorObs[currentObs].obsReport.windDir =  calDirection +90;   // NB: Offset caters for extended range -90 to 450
-			sensorObs[currentObs].obsReport.dailyRainX10 = dailyRainfallCount * Bucket_Size * 10.0;
-			sensorObs[currentObs].obsReport.casetempX10 = (DSsensors.getTempC(caseTempAddr)+ 100.0) * 10.0;
+			obsReportRainfallRate = obsRainfallCount * Bucket_Size * 3600 / periodSec;   //  mm/hr
+			sensorObs.obsReport.windGustX10 = windGustX10;
+			sensorObs.obsReport.windGustDir = ((calGustDirn + 5) / 10) % 360;	// whole degrees in the payload
+			sensorObs.obsReport.tempX10 = tempRawToX10(tempBuses.getTemp(airTempProbe));
+			sensorObs.obsReport.humidX10 = (Station::hasBarometer && barometerOk) ? bme.getHumidity()*10.0 : ObsX10_NotFitted;
+			sensorObs.obsReport.pressX10 = (Station::hasBarometer && barometerOk) ? bme.getPressure_MB()*10.0 : ObsX10_NotFitted;
+			if (!barometerOk)
+				barometerOk = bme.begin();		// fitted or freed since - in use from the next sample
+			sensorObs.obsReport.rainflX10 = obsReportRainfallRate * 10.0;
+			sensorObs.obsReport.windspX10 = sampleSpeedX10;
+			sensorObs.obsReport.windDir =  (calDirection + 905) / 10;   // NB: +90 Offset caters for extended range -90 to 450
+			sensorObs.obsReport.dailyRainX10 = dailyRainfallCount * Bucket_Size * 10.0;
+			sensorObs.obsReport.casetempX10 = tempRawToX10(tempBuses.getTemp(caseTempProbe));
+			
+			stamp_t reportStamp = sample.stamp;
+			uint32_t frameBase = stationClock.toUtc(reportStamp);
+			sensorObs.stamp.frameBase = frameBase;
+			sensorObs.stamp.gustOffset = stationClock.ticksFrom(frameBase, gustStamp);
+
+			uint8_t peakTips;
+			stamp_t firstTip;
+			obsLength = sizeof(obsSet) + sizeof(obsStamp);
+			if (rainLog.summarise(reportStamp, peakTips, firstTip)) {
+				sensorObs.rainExt.firstTipOffset = stationClock.ticksFrom(frameBase, firstTip);
+				sensorObs.rainExt.rainPeakX10 = peakTips * (uint16_t)(Bucket_Size * 60 * 10);	// tips/min -> mm/hr x10
+				obsLength += sizeof(obsRainExt);
+			}
+			uint8_t verdict = reportFilter.check(sensorObs.obsReport);
+			if (verdict != Report_Skip)
+				txPlanner.enqueue(sensorObs.readAccess(), obsLength, frameBase);
+			if (sampleRing.overflows()) {
+				Serial.print(F("Samples lost while loop busy: "));
+				Serial.println(sampleRing.overflows());
+			}
 			
 
-        //  Schedule Callback to transmit the report
-			os_setTimedCallback(&sendjob, os_getTime()+sec2osticks(TX_INTERVAL/10), do_send);
+        //  Schedule Callback to transmit the report (and any held for airtime) - urgent changes at once
+			if (verdict == Report_Urgent)
+				os_setCallback(&sendjob, do_send);
+			else if (txPlanner.pending())
+				os_setTimedCallback(&sendjob, os_getTime()+sec2osticks(settings.txDelaySec), do_send);
+			windGustX10 = 0;				// Gust reading is reset for every reporting period
+			gustStamp = reportStamp;
+			if (urgentNow) {
+				reportStartCount = sampleCount;	// the cycle runs on - its report covers the rest of it
+				continue;
+			}
 		
 			sampleCount = 0;
-			currentObs = 1- currentObs;		//
-			reportObs = 1 - currentObs;   	// switch reporting to last collected observation
-			windGust = 0;					// Gust reading is reset for every reporting period
+			reportStartCount = 0;
+			if (config.isPending())
+				applyConfig(false);
 		
 			
 		// Check if this report completes a daily cycle
 			utc = now();
-			localTime = auEastern.toLocal(utc, &tcr);
-			if (resetDaily(localTime, EOD_HOUR - 1, EOD_HOUR + 1) ){
-				tipCount = 0;
+			#ifdef EOD_ALARM
+			if (eodAlarmFired || (utc + (time_t)reportIntervalSec / 2 >= nextEodUtc)) {
+			#else
+			if (utc + (time_t)reportIntervalSec / 2 >= nextEodUtc) {
+			#endif
+				noInterrupts();
+				tipCount -= tips;			// keeps any tip since the snapshot for the new day
+				interrupts();
 				dailyRainfallCount = 0;     // Next report cycle starts daily total from 0mm
 				obsRainfallCount = 0;
+				scheduleDailyReset(utc);
 			}
 		}
-			
-		isSampleRequired = false;
 	}
 	
+	if (sampled) {
+		checkpointState();
+		if (!bootProfile.done()) {
+			bootProfile.mark(F("first sample"));
+			bootProfile.print();
+		}
+	}
+	bme.poll();					// Take up a completed BME280 read - used by the next report
+	tempBuses.harvest();		// Collect DS18B20 readings from any bus that has finished converting
+	#ifdef TIMER_DISCIPLINED
+		if (sampleClock.discipline())	// Trim Timer1 period; align reporting on first lock
+			alignPending = true;
+		if (alignPending)
+			alignPending = !alignReportPhase();
+	#endif
     os_runloop_once();
     
 }
\ No newline at end of file
@@ -0,0 +1,24 @@
+/*
+ * Arduino.h - just enough of the Arduino API to build modules natively
+ *
+ * For the [env:native] unit tests only: the Time & Timezone libraries and
+ * the modules under test include it.  The tests never read the system clock;
+ * PROGMEM data is ordinary memory on the host.
+ */
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROGMEM
+#define pgm_read_byte(addr)  (*(const uint8_t *)(addr))
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+inline unsigned long millis(void) { return 0; }
+
+#endif
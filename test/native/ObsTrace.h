@@ -0,0 +1,2041 @@
+/*
+ * ObsTrace.h - report trace for the native tests
+ *
+ * Generated by tools/obs_trace.py from tools/traces/synthetic.csv - do not edit.
+ */
+
+#ifndef ObsTrace_h
+#define ObsTrace_h
+
+#include <string.h>
+#include "ObsPayload.h"
+
+struct ObsTraceRow {
+    uint32_t frameBase;
+    int16_t gustOffset;
+    uint16_t obs[10];
+    bool rain;
+    uint16_t rainPeakX10;
+    int16_t firstTipOffset;
+};
+
+static const ObsTraceRow obsTrace[] = {
+    { 1767225900, -29, { 68, 188, 1198, 755, 10132, 0, 46, 274, 0, 1238 }, false, 0, 0 },
+    { 1767226200, -325, { 115, 171, 1192, 775, 10129, 0, 85, 280, 0, 1232 }, false, 0, 0 },
+    { 1767226500, -507, { 189, 213, 1198, 774, 10130, 0, 66, 288, 0, 1238 }, false, 0, 0 },
+    { 1767226800, -569, { 140, 191, 1193, 774, 10130, 0, 111, 295, 0, 1233 }, false, 0, 0 },
+    { 1767227100, -194, { 148, 193, 1197, 758, 10134, 0, 68, 284, 0, 1237 }, false, 0, 0 },
+    { 1767227400, -413, { 124, 228, 1190, 798, 10133, 0, 48, 312, 0, 1230 }, false, 0, 0 },
+    { 1767227700, -402, { 56, 204, 1194, 776, 10132, 0, 30, 291, 0, 1234 }, false, 0, 0 },
+    { 1767228000, -174, { 131, 193, 1194, 763, 10132, 0, 61, 293, 0, 1234 }, false, 0, 0 },
+    { 1767228300, -470, { 76, 166, 1189, 776, 10132, 0, 44, 259, 0, 1229 }, false, 0, 0 },
+    { 1767228600, -524, { 85, 165, 1195, 750, 10130, 0, 13, 267, 0, 1235 }, false, 0, 0 },
+    { 1767228900, -365, { 101, 219, 1192, 764, 10130, 0, 53, 303, 0, 1232 }, false, 0, 0 },
+    { 1767229200, -181, { 16, 224, 1212, 729, 10129, 0, 1, 299, 0, 1252 }, false, 0, 0 },
+    { 1767229500, -17, { 34, 229, 1206, 738, 10128, 0, 6, 311, 0, 1246 }, false, 0, 0 },
+    { 1767229800, -163, { 35, 196, 1207, 732, 10130, 0, 9, 290, 0, 1247 }, false, 0, 0 },
+    { 1767230100, -431, { 23, 199, 1208, 725, 10130, 0, 6, 297, 0, 1248 }, false, 0, 0 },
+    { 1767230400, -230, { 47, 189, 1210, 732, 10130, 0, 0, 298, 0, 1250 }, false, 0, 0 },
+    { 1767230700, -528, { 5, 240, 1209, 736, 10130, 0, 0, 322, 0, 1249 }, false, 0, 0 },
+    { 1767231000, -305, { 40, 220, 1205, 751, 10131, 0, 16, 322, 0, 1245 }, false, 0, 0 },
+    { 1767231300, -8, { 106, 228, 1214, 708, 10130, 0, 10, 303, 0, 1254 }, false, 0, 0 },
+    { 1767231600, -521, { 35, 192, 1207, 728, 10130, 0, 0, 300, 0, 1247 }, false, 0, 0 },
+    { 1767231900, -511, { 84, 214, 1208, 732, 10131, 0, 53, 323, 0, 1248 }, false, 0, 0 },
+    { 1767232200, -138, { 96, 230, 1211, 738, 10130, 0, 65, 319, 0, 1251 }, false, 0, 0 },
+    { 1767232500, -545, { 82, 221, 1208, 736, 10130, 0, 33, 316, 0, 1248 }, false, 0, 0 },
+    { 1767232800, -518, { 146, 210, 1220, 700, 10131, 0, 91, 304, 0, 1260 }, false, 0, 0 },
+    { 1767233100, -106, { 165, 224, 1221, 691, 10132, 0, 72, 314, 0, 1261 }, false, 0, 0 },
+    { 1767233400, -387, { 158, 191, 1221, 696, 10132, 0, 102, 297, 0, 1261 }, false, 0, 0 },
+    { 1767233700, -46, { 228, 232, 1221, 704, 10132, 0, 154, 324, 0, 1261 }, false, 0, 0 },
+    { 1767234000, -600, { 197, 223, 1221, 697, 10134, 0, 146, 307, 0, 1261 }, false, 0, 0 },
+    { 1767234300, -301, { 220, 262, 1223, 688, 10135, 0, 145, 337, 0, 1263 }, false, 0, 0 },
+    { 1767234600, -302, { 218, 240, 1221, 707, 10135, 0, 167, 312, 0, 1261 }, false, 0, 0 },
+    { 1767234900, -555, { 238, 221, 1221, 693, 10137, 0, 142, 301, 0, 1261 }, false, 0, 0 },
+    { 1767235200, -458, { 180, 214, 1222, 686, 10136, 0, 137, 319, 0, 1262 }, false, 0, 0 },
+    { 1767235500, -310, { 204, 207, 1220, 707, 10134, 0, 129, 302, 0, 1260 }, false, 0, 0 },
+    { 1767235800, -74, { 141, 224, 1225, 695, 10133, 0, 105, 317, 0, 1265 }, false, 0, 0 },
+    { 1767236100, -513, { 226, 195, 1221, 708, 10133, 0, 119, 285, 0, 1261 }, false, 0, 0 },
+    { 1767236400, -109, { 286, 235, 1232, 681, 10137, 0, 170, 313, 0, 1272 }, false, 0, 0 },
+    { 1767236700, -566, { 178, 224, 1233, 671, 10135, 0, 116, 321, 0, 1273 }, false, 0, 0 },
+    { 1767237000, -457, { 250, 224, 1228, 688, 10135, 0, 186, 307, 0, 1268 }, false, 0, 0 },
+    { 1767237300, -426, { 199, 243, 1229, 682, 10135, 0, 132, 317, 0, 1269 }, false, 0, 0 },
+    { 1767237600, -577, { 229, 265, 1232, 670, 10137, 0, 116, 350, 0, 1272 }, false, 0, 0 },
+    { 1767237900, -231, { 229, 254, 1232, 662, 10138, 0, 113, 349, 0, 1272 }, false, 0, 0 },
+    { 1767238200, -281, { 219, 240, 1229, 689, 10137, 0, 144, 336, 0, 1269 }, false, 0, 0 },
+    { 1767238500, -565, { 272, 242, 1232, 647, 10137, 0, 169, 329, 0, 1272 }, false, 0, 0 },
+    { 1767238800, -386, { 229, 235, 1230, 686, 10138, 0, 146, 334, 0, 1270 }, false, 0, 0 },
+    { 1767239100, -168, { 227, 228, 1233, 682, 10140, 0, 140, 304, 0, 1273 }, false, 0, 0 },
+    { 1767239400, -142, { 229, 241, 1233, 662, 10139, 0, 158, 312, 0, 1273 }, false, 0, 0 },
+    { 1767239700, -168, { 288, 211, 1233, 662, 10138, 0, 195, 301, 0, 1273 }, false, 0, 0 },
+    { 1767240000, -302, { 224, 237, 1240, 654, 10136, 0, 138, 330, 0, 1280 }, false, 0, 0 },
+    { 1767240300, -211, { 178, 209, 1237, 661, 10138, 0, 133, 308, 0, 1277 }, false, 0, 0 },
+    { 1767240600, -172, { 201, 269, 1235, 672, 10138, 0, 161, 345, 0, 1275 }, false, 0, 0 },
+    { 1767240900, -582, { 212, 225, 1236, 663, 10139, 0, 151, 335, 0, 1276 }, false, 0, 0 },
+    { 1767241200, -318, { 165, 254, 1233, 657, 10135, 0, 90, 337, 0, 1273 }, false, 0, 0 },
+    { 1767241500, -585, { 183, 240, 1236, 659, 10135, 0, 124, 319, 0, 1276 }, false, 0, 0 },
+    { 1767241800, -523, { 243, 226, 1239, 664, 10138, 0, 147, 324, 0, 1279 }, false, 0, 0 },
+    { 1767242100, -543, { 268, 224, 1240, 654, 10138, 0, 115, 322, 0, 1280 }, false, 0, 0 },
+    { 1767242400, -69, { 215, 263, 1239, 652, 10138, 0, 118, 342, 0, 1279 }, false, 0, 0 },
+    { 1767242700, -276, { 173, 241, 1239, 659, 10138, 0, 134, 340, 0, 1279 }, false, 0, 0 },
+    { 1767243000, -557, { 113, 258, 1240, 629, 10138, 0, 80, 349, 0, 1280 }, false, 0, 0 },
+    { 1767243300, -453, { 157, 217, 1240, 638, 10140, 0, 116, 326, 0, 1280 }, false, 0, 0 },
+    { 1767243600, -540, { 154, 220, 1237, 668, 10141, 0, 104, 317, 0, 1277 }, false, 0, 0 },
+    { 1767243900, -304, { 194, 233, 1240, 663, 10143, 0, 131, 308, 0, 1280 }, false, 0, 0 },
+    { 1767244200, -337, { 199, 254, 1240, 662, 10142, 0, 134, 350, 0, 1280 }, false, 0, 0 },
+    { 1767244500, -254, { 258, 206, 1239, 650, 10144, 0, 154, 299, 0, 1279 }, false, 0, 0 },
+    { 1767244800, -268, { 325, 258, 1242, 656, 10145, 0, 197, 339, 0, 1282 }, false, 0, 0 },
+    { 1767245100, -312, { 249, 223, 1238, 662, 10145, 0, 147, 329, 0, 1278 }, false, 0, 0 },
+    { 1767245400, -221, { 216, 225, 1243, 648, 10146, 0, 162, 333, 0, 1283 }, false, 0, 0 },
+    { 1767245700, -227, { 164, 240, 1237, 652, 10146, 0, 103, 325, 0, 1277 }, false, 0, 0 },
+    { 1767246000, -398, { 119, 244, 1242, 654, 10147, 0, 77, 341, 0, 1282 }, false, 0, 0 },
+    { 1767246300, -392, { 188, 257, 1238, 648, 10147, 0, 133, 330, 0, 1278 }, false, 0, 0 },
+    { 1767246600, -396, { 265, 207, 1240, 656, 10147, 0, 178, 308, 0, 1280 }, false, 0, 0 },
+    { 1767246900, -537, { 238, 226, 1241, 638, 10145, 0, 167, 328, 0, 1281 }, false, 0, 0 },
+    { 1767247200, -196, { 253, 251, 1238, 656, 10147, 0, 152, 333, 0, 1278 }, false, 0, 0 },
+    { 1767247500, -573, { 200, 278, 1235, 674, 10148, 0, 143, 348, 0, 1275 }, false, 0, 0 },
+    { 1767247800, -71, { 215, 266, 1236, 657, 10147, 0, 149, 359, 0, 1276 }, false, 0, 0 },
+    { 1767248100, -54, { 173, 285, 1237, 655, 10145, 0, 133, 355, 0, 1277 }, false, 0, 0 },
+    { 1767248400, -453, { 155, 227, 1236, 669, 10147, 0, 111, 329, 0, 1276 }, false, 0, 0 },
+    { 1767248700, -393, { 157, 222, 1240, 657, 10146, 0, 96, 329, 0, 1280 }, false, 0, 0 },
+    { 1767249000, -435, { 204, 207, 1239, 642, 10146, 0, 142, 302, 0, 1279 }, false, 0, 0 },
+    { 1767249300, -536, { 161, 247, 1236, 669, 10146, 0, 75, 322, 0, 1276 }, false, 0, 0 },
+    { 1767249600, -160, { 169, 214, 1238, 636, 10145, 0, 78, 312, 0, 1278 }, false, 0, 0 },
+    { 1767249900, -305, { 143, 248, 1236, 666, 10146, 0, 105, 338, 0, 1276 }, false, 0, 0 },
+    { 1767250200, -333, { 142, 238, 1235, 668, 10146, 0, 86, 328, 0, 1275 }, false, 0, 0 },
+    { 1767250500, -592, { 192, 199, 1235, 657, 10145, 0, 104, 306, 0, 1275 }, false, 0, 0 },
+    { 1767250800, -370, { 94, 220, 1234, 672, 10146, 0, 56, 307, 0, 1274 }, false, 0, 0 },
+    { 1767251100, -189, { 132, 238, 1230, 686, 10147, 0, 88, 322, 0, 1270 }, false, 0, 0 },
+    { 1767251400, -68, { 102, 238, 1229, 670, 10149, 0, 46, 308, 0, 1269 }, false, 0, 0 },
+    { 1767251700, -498, { 182, 221, 1229, 687, 10148, 0, 84, 313, 0, 1269 }, false, 0, 0 },
+    { 1767252000, -193, { 64, 265, 1231, 677, 10148, 0, 46, 345, 0, 1271 }, false, 0, 0 },
+    { 1767252300, -413, { 131, 260, 1231, 679, 10145, 0, 54, 331, 0, 1271 }, false, 0, 0 },
+    { 1767252600, -306, { 77, 205, 1229, 664, 10147, 0, 38, 315, 0, 1269 }, false, 0, 0 },
+    { 1767252900, -421, { 98, 223, 1228, 647, 10147, 0, 23, 299, 0, 1268 }, false, 0, 0 },
+    { 1767253200, -454, { 57, 247, 1226, 674, 10150, 0, 14, 320, 0, 1266 }, false, 0, 0 },
+    { 1767253500, -288, { 43, 217, 1234, 672, 10152, 0, 36, 326, 0, 1274 }, false, 0, 0 },
+    { 1767253800, -492, { 84, 245, 1231, 657, 10155, 0, 7, 334, 0, 1271 }, false, 0, 0 },
+    { 1767254100, -294, { 175, 249, 1229, 671, 10156, 0, 63, 333, 0, 1269 }, false, 0, 0 },
+    { 1767254400, -503, { 70, 253, 1220, 710, 10156, 0, 0, 338, 0, 1260 }, false, 0, 0 },
+    { 1767254700, -408, { 76, 228, 1222, 712, 10156, 0, 52, 327, 0, 1262 }, false, 0, 0 },
+    { 1767255000, -105, { 51, 246, 1224, 684, 10156, 0, 0, 321, 0, 1264 }, false, 0, 0 },
+    { 1767255300, -219, { 23, 229, 1220, 696, 10153, 0, 0, 334, 0, 1260 }, false, 0, 0 },
+    { 1767255600, -490, { 49, 222, 1219, 697, 10154, 0, 9, 326, 0, 1259 }, false, 0, 0 },
+    { 1767255900, -557, { 65, 246, 1224, 688, 10156, 0, 0, 343, 0, 1264 }, false, 0, 0 },
+    { 1767256200, -273, { 4, 194, 1221, 682, 10156, 0, 0, 301, 0, 1261 }, false, 0, 0 },
+    { 1767256500, -199, { 33, 237, 1220, 700, 10156, 0, 2, 321, 0, 1260 }, false, 0, 0 },
+    { 1767256800, -286, { 34, 239, 1220, 693, 10154, 0, 11, 319, 0, 1260 }, false, 0, 0 },
+    { 1767257100, -461, { 30, 241, 1221, 697, 10153, 0, 14, 317, 0, 1261 }, false, 0, 0 },
+    { 1767257400, -505, { 37, 199, 1221, 705, 10154, 0, 22, 279, 0, 1261 }, false, 0, 0 },
+    { 1767257700, -231, { 90, 244, 1221, 700, 10154, 0, 54, 318, 0, 1261 }, false, 0, 0 },
+    { 1767258000, -225, { 52, 218, 1207, 743, 10155, 0, 30, 323, 0, 1247 }, false, 0, 0 },
+    { 1767258300, -116, { 89, 223, 1209, 711, 10154, 0, 19, 317, 0, 1249 }, false, 0, 0 },
+    { 1767258600, -254, { 128, 259, 1210, 719, 10154, 0, 2, 352, 0, 1250 }, false, 0, 0 },
+    { 1767258900, -8, { 59, 241, 1208, 749, 10154, 0, 5, 319, 0, 1248 }, false, 0, 0 },
+    { 1767259200, -277, { 114, 213, 1209, 710, 10157, 0, 82, 298, 0, 1249 }, false, 0, 0 },
+    { 1767259500, -136, { 56, 211, 1212, 717, 10158, 0, 0, 318, 0, 1252 }, false, 0, 0 },
+    { 1767259800, -542, { 93, 229, 1211, 718, 10158, 0, 80, 323, 0, 1251 }, false, 0, 0 },
+    { 1767260100, -594, { 88, 183, 1207, 737, 10158, 0, 32, 292, 0, 1247 }, false, 0, 0 },
+    { 1767260400, -495, { 124, 220, 1208, 720, 10157, 0, 56, 309, 0, 1248 }, false, 0, 0 },
+    { 1767260700, -8, { 140, 251, 1208, 737, 10158, 0, 83, 327, 0, 1248 }, false, 0, 0 },
+    { 1767261000, -442, { 144, 234, 1209, 718, 10161, 0, 48, 306, 0, 1249 }, false, 0, 0 },
+    { 1767261300, -43, { 93, 219, 1209, 719, 10160, 0, 66, 322, 0, 1249 }, false, 0, 0 },
+    { 1767261600, -364, { 85, 218, 1192, 761, 10158, 0, 51, 298, 0, 1232 }, false, 0, 0 },
+    { 1767261900, -321, { 83, 248, 1196, 762, 10157, 0, 48, 331, 0, 1236 }, false, 0, 0 },
+    { 1767262200, -385, { 13, 223, 1198, 747, 10158, 0, 0, 311, 0, 1238 }, false, 0, 0 },
+    { 1767262500, -176, { 82, 260, 1194, 749, 10161, 0, 31, 336, 0, 1234 }, false, 0, 0 },
+    { 1767262800, -392, { 79, 244, 1196, 749, 10160, 0, 61, 314, 0, 1236 }, false, 0, 0 },
+    { 1767263100, -482, { 100, 213, 1196, 758, 10159, 0, 0, 300, 0, 1236 }, false, 0, 0 },
+    { 1767263400, -272, { 67, 218, 1192, 769, 10156, 0, 13, 320, 0, 1232 }, false, 0, 0 },
+    { 1767263700, -295, { 59, 214, 1196, 760, 10158, 0, 39, 315, 0, 1236 }, false, 0, 0 },
+    { 1767264000, -233, { 129, 242, 1192, 778, 10159, 0, 47, 318, 0, 1232 }, false, 0, 0 },
+    { 1767264300, -549, { 45, 246, 1193, 759, 10154, 0, 24, 321, 0, 1233 }, false, 0, 0 },
+    { 1767264600, -194, { 76, 245, 1198, 752, 10155, 0, 6, 323, 0, 1238 }, false, 0, 0 },
+    { 1767264900, -490, { 43, 193, 1194, 756, 10153, 0, 18, 301, 0, 1234 }, false, 0, 0 },
+    { 1767265200, -136, { 85, 246, 1178, 802, 10154, 0, 57, 321, 0, 1218 }, false, 0, 0 },
+    { 1767265500, -205, { 44, 237, 1179, 790, 10153, 0, 29, 316, 0, 1219 }, false, 0, 0 },
+    { 1767265800, -369, { 140, 197, 1181, 787, 10153, 0, 82, 286, 0, 1221 }, false, 0, 0 },
+    { 1767266100, -72, { 98, 271, 1181, 796, 10153, 0, 73, 344, 0, 1221 }, false, 0, 0 },
+    { 1767266400, -200, { 125, 193, 1178, 802, 10152, 0, 66, 298, 0, 1218 }, false, 0, 0 },
+    { 1767266700, -551, { 95, 222, 1179, 802, 10152, 0, 43, 298, 0, 1219 }, false, 0, 0 },
+    { 1767267000, -182, { 118, 172, 1177, 809, 10153, 0, 45, 268, 0, 1217 }, false, 0, 0 },
+    { 1767267300, -105, { 32, 233, 1179, 792, 10153, 0, 18, 304, 0, 1219 }, false, 0, 0 },
+    { 1767267600, -105, { 41, 192, 1179, 808, 10152, 0, 27, 295, 0, 1219 }, false, 0, 0 },
+    { 1767267900, -393, { 45, 245, 1181, 795, 10151, 0, 31, 322, 0, 1221 }, false, 0, 0 },
+    { 1767268200, -387, { 75, 229, 1178, 816, 10152, 0, 43, 309, 0, 1218 }, false, 0, 0 },
+    { 1767268500, -431, { 89, 218, 1178, 809, 10152, 0, 31, 303, 0, 1218 }, false, 0, 0 },
+    { 1767268800, -219, { 93, 210, 1166, 838, 10152, 0, 38, 295, 0, 1206 }, false, 0, 0 },
+    { 1767269100, -177, { 101, 243, 1165, 855, 10150, 0, 57, 315, 0, 1205 }, false, 0, 0 },
+    { 1767269400, -66, { 47, 232, 1165, 837, 10147, 0, 34, 321, 0, 1205 }, false, 0, 0 },
+    { 1767269700, -579, { 114, 212, 1166, 837, 10146, 0, 40, 297, 0, 1206 }, false, 0, 0 },
+    { 1767270000, -50, { 10, 234, 1165, 842, 10147, 0, 0, 309, 0, 1205 }, false, 0, 0 },
+    { 1767270300, -67, { 72, 209, 1168, 837, 10146, 0, 1, 281, 0, 1208 }, false, 0, 0 },
+    { 1767270600, -587, { 50, 200, 1163, 825, 10147, 0, 37, 277, 0, 1203 }, false, 0, 0 },
+    { 1767270900, -552, { 21, 198, 1168, 823, 10147, 0, 0, 280, 0, 1208 }, false, 0, 0 },
+    { 1767271200, -594, { 31, 186, 1163, 861, 10146, 0, 0, 287, 0, 1203 }, false, 0, 0 },
+    { 1767271500, -252, { 28, 199, 1162, 850, 10145, 0, 0, 293, 0, 1202 }, false, 0, 0 },
+    { 1767271800, -273, { 88, 221, 1166, 823, 10145, 0, 34, 305, 0, 1206 }, false, 0, 0 },
+    { 1767272100, -208, { 35, 192, 1165, 834, 10146, 0, 3, 268, 0, 1205 }, false, 0, 0 },
+    { 1767272400, -38, { 45, 194, 1150, 877, 10147, 0, 8, 303, 0, 1190 }, false, 0, 0 },
+    { 1767272700, -202, { 107, 182, 1152, 876, 10147, 0, 34, 278, 0, 1192 }, false, 0, 0 },
+    { 1767273000, -467, { 44, 210, 1148, 882, 10147, 0, 31, 299, 0, 1188 }, false, 0, 0 },
+    { 1767273300, -40, { 85, 170, 1152, 854, 10146, 0, 61, 280, 0, 1192 }, false, 0, 0 },
+    { 1767273600, -248, { 93, 206, 1150, 895, 10147, 0, 52, 285, 0, 1190 }, false, 0, 0 },
+    { 1767273900, -485, { 71, 173, 1148, 883, 10147, 0, 41, 260, 0, 1188 }, false, 0, 0 },
+    { 1767274200, -596, { 157, 166, 1146, 884, 10147, 0, 86, 255, 0, 1186 }, false, 0, 0 },
+    { 1767274500, -489, { 76, 196, 1148, 882, 10149, 0, 47, 268, 0, 1188 }, false, 0, 0 },
+    { 1767274800, -537, { 182, 199, 1148, 867, 10148, 0, 79, 290, 0, 1188 }, false, 0, 0 },
+    { 1767275100, -237, { 156, 222, 1146, 877, 10147, 0, 78, 300, 0, 1186 }, false, 0, 0 },
+    { 1767275400, -113, { 156, 185, 1150, 878, 10145, 0, 95, 273, 0, 1190 }, false, 0, 0 },
+    { 1767275700, -50, { 198, 180, 1153, 866, 10142, 0, 146, 277, 0, 1193 }, false, 0, 0 },
+    { 1767276000, -419, { 180, 220, 1139, 893, 10142, 0, 82, 292, 0, 1179 }, false, 0, 0 },
+    { 1767276300, -387, { 194, 197, 1137, 897, 10142, 0, 98, 281, 0, 1177 }, false, 0, 0 },
+    { 1767276600, -43, { 141, 203, 1134, 901, 10146, 0, 71, 274, 0, 1174 }, false, 0, 0 },
+    { 1767276900, -314, { 143, 190, 1137, 903, 10147, 0, 70, 272, 0, 1177 }, false, 0, 0 },
+    { 1767277200, -325, { 220, 196, 1140, 898, 10145, 0, 111, 268, 0, 1180 }, false, 0, 0 },
+    { 1767277500, -225, { 111, 206, 1139, 906, 10146, 0, 52, 278, 0, 1179 }, false, 0, 0 },
+    { 1767277800, -527, { 148, 207, 1134, 896, 10146, 0, 98, 285, 0, 1174 }, false, 0, 0 },
+    { 1767278100, -67, { 106, 192, 1136, 933, 10146, 0, 81, 299, 0, 1176 }, false, 0, 0 },
+    { 1767278400, -302, { 132, 203, 1138, 903, 10148, 0, 81, 276, 0, 1178 }, false, 0, 0 },
+    { 1767278700, -416, { 145, 156, 1136, 910, 10148, 0, 99, 259, 0, 1176 }, false, 0, 0 },
+    { 1767279000, -100, { 72, 176, 1136, 908, 10148, 0, 46, 283, 0, 1176 }, false, 0, 0 },
+    { 1767279300, -453, { 136, 172, 1138, 914, 10146, 0, 98, 270, 0, 1178 }, false, 0, 0 },
+    { 1767279600, -225, { 142, 173, 1129, 911, 10146, 0, 111, 265, 0, 1169 }, false, 0, 0 },
+    { 1767279900, -391, { 171, 179, 1127, 942, 10144, 0, 79, 265, 0, 1167 }, false, 0, 0 },
+    { 1767280200, -245, { 115, 173, 1129, 938, 10147, 0, 73, 279, 0, 1169 }, false, 0, 0 },
+    { 1767280500, -323, { 162, 193, 1128, 927, 10146, 0, 123, 278, 0, 1168 }, false, 0, 0 },
+    { 1767280800, -153, { 145, 177, 1126, 931, 10147, 0, 109, 277, 0, 1166 }, false, 0, 0 },
+    { 1767281100, -317, { 140, 157, 1125, 939, 10148, 0, 90, 263, 0, 1165 }, false, 0, 0 },
+    { 1767281400, -191, { 170, 169, 1127, 937, 10146, 0, 97, 249, 0, 1167 }, false, 0, 0 },
+    { 1767281700, -515, { 201, 167, 1122, 943, 10145, 0, 85, 237, 0, 1162 }, false, 0, 0 },
+    { 1767282000, -215, { 213, 189, 1127, 921, 10146, 0, 101, 296, 0, 1167 }, false, 0, 0 },
+    { 1767282300, -99, { 169, 186, 1128, 924, 10149, 0, 121, 288, 0, 1168 }, false, 0, 0 },
+    { 1767282600, -552, { 220, 203, 1126, 944, 10149, 0, 136, 275, 0, 1166 }, false, 0, 0 },
+    { 1767282900, -75, { 180, 158, 1130, 906, 10148, 0, 117, 251, 0, 1170 }, false, 0, 0 },
+    { 1767283200, -368, { 217, 172, 1121, 961, 10149, 0, 154, 277, 0, 1161 }, false, 0, 0 },
+    { 1767283500, -18, { 193, 156, 1119, 953, 10147, 0, 131, 253, 0, 1159 }, false, 0, 0 },
+    { 1767283800, -69, { 223, 199, 1124, 949, 10147, 0, 145, 277, 0, 1164 }, false, 0, 0 },
+    { 1767284100, -73, { 178, 153, 1120, 917, 10149, 0, 90, 247, 0, 1160 }, false, 0, 0 },
+    { 1767284400, -258, { 174, 183, 1121, 953, 10151, 0, 122, 274, 0, 1161 }, false, 0, 0 },
+    { 1767284700, -579, { 180, 164, 1124, 945, 10150, 0, 123, 243, 0, 1164 }, false, 0, 0 },
+    { 1767285000, -580, { 164, 175, 1123, 935, 10149, 0, 104, 273, 0, 1163 }, false, 0, 0 },
+    { 1767285300, -519, { 176, 181, 1120, 962, 10150, 0, 86, 261, 0, 1160 }, false, 0, 0 },
+    { 1767285600, -565, { 166, 178, 1125, 930, 10147, 0, 90, 253, 0, 1165 }, false, 0, 0 },
+    { 1767285900, -559, { 173, 162, 1123, 934, 10146, 0, 110, 253, 0, 1163 }, false, 0, 0 },
+    { 1767286200, -372, { 190, 211, 1123, 933, 10147, 0, 97, 285, 0, 1163 }, false, 0, 0 },
+    { 1767286500, -213, { 131, 161, 1120, 939, 10149, 0, 63, 246, 0, 1160 }, false, 0, 0 },
+    { 1767286800, -542, { 199, 175, 1118, 953, 10150, 0, 157, 266, 0, 1158 }, false, 0, 0 },
+    { 1767287100, -211, { 165, 152, 1120, 937, 10152, 0, 90, 244, 0, 1160 }, false, 0, 0 },
+    { 1767287400, -183, { 176, 196, 1119, 936, 10151, 0, 88, 267, 0, 1159 }, false, 0, 0 },
+    { 1767287700, -406, { 151, 172, 1121, 936, 10150, 0, 104, 271, 0, 1161 }, false, 0, 0 },
+    { 1767288000, -297, { 147, 161, 1121, 948, 10149, 0, 71, 249, 0, 1161 }, false, 0, 0 },
+    { 1767288300, -235, { 158, 175, 1120, 944, 10148, 0, 84, 257, 0, 1160 }, false, 0, 0 },
+    { 1767288600, -476, { 147, 172, 1119, 943, 10149, 0, 79, 261, 0, 1159 }, false, 0, 0 },
+    { 1767288900, -140, { 173, 175, 1118, 942, 10149, 0, 106, 246, 0, 1158 }, false, 0, 0 },
+    { 1767289200, -435, { 156, 140, 1120, 966, 10149, 0, 108, 247, 0, 1160 }, false, 0, 0 },
+    { 1767289500, -595, { 137, 165, 1114, 942, 10151, 0, 83, 251, 0, 1154 }, false, 0, 0 },
+    { 1767289800, -549, { 202, 169, 1118, 969, 10150, 0, 128, 259, 0, 1158 }, false, 0, 0 },
+    { 1767290100, -496, { 159, 160, 1118, 965, 10152, 0, 80, 245, 0, 1158 }, false, 0, 0 },
+    { 1767290400, -328, { 224, 155, 1124, 919, 10154, 0, 132, 226, 0, 1164 }, false, 0, 0 },
+    { 1767290700, -295, { 162, 148, 1122, 953, 10152, 0, 89, 244, 0, 1162 }, false, 0, 0 },
+    { 1767291000, -358, { 194, 181, 1120, 979, 10151, 0, 109, 253, 0, 1160 }, false, 0, 0 },
+    { 1767291300, -4, { 143, 173, 1122, 949, 10148, 0, 88, 261, 0, 1162 }, false, 0, 0 },
+    { 1767291600, -147, { 151, 122, 1125, 940, 10150, 0, 111, 208, 0, 1165 }, false, 0, 0 },
+    { 1767291900, -164, { 158, 153, 1119, 940, 10150, 0, 120, 254, 0, 1159 }, false, 0, 0 },
+    { 1767292200, -324, { 145, 202, 1123, 951, 10152, 0, 86, 274, 0, 1163 }, false, 0, 0 },
+    { 1767292500, -578, { 92, 156, 1123, 945, 10153, 0, 65, 257, 0, 1163 }, false, 0, 0 },
+    { 1767292800, -472, { 180, 151, 1121, 961, 10154, 0, 116, 249, 0, 1161 }, false, 0, 0 },
+    { 1767293100, -112, { 117, 170, 1121, 946, 10153, 0, 81, 255, 0, 1161 }, false, 0, 0 },
+    { 1767293400, -441, { 131, 147, 1120, 957, 10152, 0, 89, 234, 0, 1160 }, false, 0, 0 },
+    { 1767293700, -246, { 208, 168, 1119, 943, 10149, 0, 155, 253, 0, 1159 }, false, 0, 0 },
+    { 1767294000, -440, { 165, 132, 1129, 930, 10147, 0, 104, 225, 0, 1169 }, false, 0, 0 },
+    { 1767294300, -535, { 179, 159, 1124, 933, 10149, 0, 115, 246, 0, 1164 }, false, 0, 0 },
+    { 1767294600, -19, { 134, 150, 1127, 925, 10147, 0, 79, 237, 0, 1167 }, false, 0, 0 },
+    { 1767294900, -513, { 182, 162, 1129, 924, 10148, 0, 125, 266, 0, 1169 }, false, 0, 0 },
+    { 1767295200, -535, { 175, 142, 1127, 944, 10150, 0, 69, 228, 0, 1167 }, false, 0, 0 },
+    { 1767295500, -200, { 128, 142, 1124, 934, 10151, 0, 57, 245, 0, 1164 }, false, 0, 0 },
+    { 1767295800, -63, { 156, 174, 1128, 915, 10150, 0, 107, 248, 0, 1168 }, false, 0, 0 },
+    { 1767296100, -329, { 177, 159, 1126, 923, 10150, 0, 133, 239, 0, 1166 }, false, 0, 0 },
+    { 1767296400, -328, { 114, 176, 1128, 930, 10150, 0, 63, 254, 0, 1168 }, false, 0, 0 },
+    { 1767296700, -17, { 109, 123, 1130, 939, 10150, 0, 86, 229, 0, 1170 }, false, 0, 0 },
+    { 1767297000, -554, { 124, 181, 1130, 924, 10151, 0, 55, 272, 0, 1170 }, false, 0, 0 },
+    { 1767297300, -14, { 132, 161, 1129, 933, 10153, 0, 99, 237, 0, 1169 }, false, 0, 0 },
+    { 1767297600, -513, { 92, 162, 1136, 915, 10153, 0, 54, 271, 0, 1176 }, false, 0, 0 },
+    { 1767297900, -542, { 115, 175, 1136, 902, 10153, 0, 48, 264, 0, 1176 }, false, 0, 0 },
+    { 1767298200, -312, { 106, 155, 1136, 900, 10151, 0, 76, 253, 0, 1176 }, false, 0, 0 },
+    { 1767298500, -591, { 115, 144, 1138, 907, 10152, 0, 46, 239, 0, 1178 }, false, 0, 0 },
+    { 1767298800, -432, { 257, 183, 1136, 913, 10153, 0, 130, 266, 0, 1176 }, false, 0, 0 },
+    { 1767299100, -363, { 268, 174, 1137, 908, 10153, 0, 181, 252, 0, 1177 }, false, 0, 0 },
+    { 1767299400, -329, { 195, 148, 1132, 902, 10157, 0, 119, 245, 0, 1172 }, false, 0, 0 },
+    { 1767299700, -483, { 168, 156, 1137, 917, 10158, 0, 101, 247, 0, 1177 }, false, 0, 0 },
+    { 1767300000, -35, { 199, 172, 1132, 935, 10158, 0, 161, 258, 0, 1172 }, false, 0, 0 },
+    { 1767300300, -100, { 209, 151, 1133, 929, 10158, 0, 104, 246, 0, 1173 }, false, 0, 0 },
+    { 1767300600, -443, { 227, 150, 1135, 924, 10158, 0, 153, 235, 0, 1175 }, false, 0, 0 },
+    { 1767300900, -97, { 167, 162, 1135, 911, 10158, 0, 125, 260, 0, 1175 }, false, 0, 0 },
+    { 1767301200, -574, { 144, 162, 1151, 865, 10156, 0, 110, 238, 0, 1191 }, false, 0, 0 },
+    { 1767301500, -290, { 177, 152, 1150, 874, 10153, 0, 74, 254, 0, 1190 }, false, 0, 0 },
+    { 1767301800, -400, { 148, 169, 1147, 870, 10153, 0, 99, 248, 0, 1187 }, false, 0, 0 },
+    { 1767302100, -300, { 175, 181, 1151, 862, 10151, 0, 125, 252, 0, 1191 }, false, 0, 0 },
+    { 1767302400, -481, { 211, 174, 1150, 877, 10154, 0, 141, 245, 0, 1190 }, false, 0, 0 },
+    { 1767302700, -222, { 146, 157, 1148, 880, 10155, 0, 79, 248, 0, 1188 }, false, 0, 0 },
+    { 1767303000, -235, { 135, 141, 1151, 869, 10156, 0, 64, 242, 0, 1191 }, false, 0, 0 },
+    { 1767303300, -75, { 182, 190, 1153, 873, 10155, 0, 102, 280, 0, 1193 }, false, 0, 0 },
+    { 1767303600, -225, { 148, 188, 1149, 887, 10154, 0, 106, 258, 0, 1189 }, false, 0, 0 },
+    { 1767303900, -469, { 164, 156, 1148, 873, 10158, 0, 110, 266, 0, 1188 }, false, 0, 0 },
+    { 1767304200, -301, { 129, 165, 1151, 867, 10157, 0, 74, 256, 0, 1191 }, false, 0, 0 },
+    { 1767304500, -463, { 135, 168, 1149, 874, 10158, 0, 108, 259, 0, 1189 }, false, 0, 0 },
+    { 1767304800, -26, { 116, 167, 1164, 848, 10160, 0, 79, 249, 0, 1204 }, false, 0, 0 },
+    { 1767305100, -140, { 230, 174, 1164, 839, 10160, 0, 118, 264, 0, 1204 }, false, 0, 0 },
+    { 1767305400, -555, { 138, 171, 1164, 836, 10161, 0, 80, 257, 0, 1204 }, false, 0, 0 },
+    { 1767305700, -26, { 156, 154, 1166, 826, 10159, 0, 91, 231, 0, 1206 }, false, 0, 0 },
+    { 1767306000, -514, { 176, 135, 1167, 834, 10160, 0, 103, 241, 0, 1207 }, false, 0, 0 },
+    { 1767306300, -306, { 90, 183, 1164, 826, 10160, 0, 52, 260, 0, 1204 }, false, 0, 0 },
+    { 1767306600, -491, { 155, 156, 1166, 836, 10162, 0, 107, 256, 0, 1206 }, false, 0, 0 },
+    { 1767306900, -179, { 192, 181, 1168, 831, 10163, 0, 94, 278, 0, 1208 }, false, 0, 0 },
+    { 1767307200, -346, { 176, 155, 1165, 829, 10160, 0, 98, 233, 0, 1205 }, false, 0, 0 },
+    { 1767307500, -579, { 186, 130, 1162, 832, 10161, 0, 105, 226, 0, 1202 }, false, 0, 0 },
+    { 1767307800, -429, { 282, 171, 1166, 844, 10159, 0, 176, 244, 0, 1206 }, false, 0, 0 },
+    { 1767308100, -343, { 256, 154, 1158, 847, 10159, 0, 130, 262, 0, 1198 }, false, 0, 0 },
+    { 1767308400, -453, { 189, 173, 1181, 808, 10159, 0, 124, 268, 0, 1221 }, false, 0, 0 },
+    { 1767308700, -224, { 215, 188, 1178, 812, 10159, 0, 158, 280, 0, 1218 }, false, 0, 0 },
+    { 1767309000, -483, { 216, 142, 1181, 790, 10159, 0, 165, 246, 0, 1221 }, false, 0, 0 },
+    { 1767309300, -345, { 192, 147, 1177, 808, 10158, 0, 148, 256, 0, 1217 }, false, 0, 0 },
+    { 1767309600, -451, { 191, 152, 1182, 796, 10157, 0, 137, 230, 0, 1222 }, false, 0, 0 },
+    { 1767309900, -39, { 227, 155, 1180, 800, 10158, 0, 172, 238, 0, 1220 }, false, 0, 0 },
+    { 1767310200, -386, { 200, 192, 1181, 820, 10158, 0, 89, 276, 0, 1221 }, false, 0, 0 },
+    { 1767310500, -164, { 215, 188, 1178, 792, 10159, 0, 165, 264, 0, 1218 }, false, 0, 0 },
+    { 1767310800, -355, { 240, 184, 1177, 804, 10158, 0, 133, 265, 0, 1217 }, false, 0, 0 },
+    { 1767311100, -74, { 175, 170, 1181, 793, 10156, 0, 107, 264, 0, 1221 }, false, 0, 0 },
+    { 1767311400, -495, { 263, 155, 1178, 793, 10156, 0, 179, 258, 0, 1218 }, false, 0, 0 },
+    { 1767311700, -541, { 172, 185, 1180, 803, 10157, 0, 115, 265, 0, 1220 }, false, 0, 0 },
+    { 1767312000, -398, { 214, 188, 1195, 751, 10158, 0, 154, 280, 0, 1235 }, false, 0, 0 },
+    { 1767312300, -154, { 185, 160, 1198, 744, 10160, 0, 114, 267, 0, 1238 }, false, 0, 0 },
+    { 1767312600, -181, { 195, 157, 1193, 774, 10159, 0, 147, 258, 0, 1233 }, false, 0, 0 },
+    { 1767312900, -165, { 126, 162, 1195, 751, 10156, 0, 83, 259, 0, 1235 }, false, 0, 0 },
+    { 1767313200, -77, { 239, 164, 1197, 774, 10155, 0, 139, 273, 0, 1237 }, false, 0, 0 },
+    { 1767313500, -83, { 154, 221, 1194, 772, 10155, 0, 97, 294, 0, 1234 }, false, 0, 0 },
+    { 1767313800, -24, { 183, 176, 1192, 758, 10153, 0, 119, 275, 0, 1232 }, false, 0, 0 },
+    { 1767314100, -107, { 285, 199, 1194, 752, 10156, 0, 135, 284, 0, 1234 }, false, 0, 0 },
+    { 1767314400, -57, { 218, 170, 1194, 763, 10155, 0, 131, 262, 0, 1234 }, false, 0, 0 },
+    { 1767314700, -401, { 194, 187, 1193, 766, 10157, 0, 128, 294, 0, 1233 }, false, 0, 0 },
+    { 1767315000, -579, { 210, 176, 1195, 753, 10155, 0, 130, 285, 0, 1235 }, false, 0, 0 },
+    { 1767315300, -292, { 211, 199, 1200, 739, 10155, 0, 161, 276, 0, 1240 }, false, 0, 0 },
+    { 1767315600, -262, { 178, 172, 1208, 717, 10155, 0, 105, 280, 0, 1248 }, false, 0, 0 },
+    { 1767315900, -128, { 193, 166, 1210, 733, 10153, 0, 135, 244, 0, 1250 }, false, 0, 0 },
+    { 1767316200, -297, { 131, 196, 1213, 713, 10154, 0, 95, 296, 0, 1253 }, false, 0, 0 },
+    { 1767316500, -479, { 224, 196, 1212, 714, 10151, 0, 166, 297, 0, 1252 }, false, 0, 0 },
+    { 1767316800, -116, { 166, 166, 1206, 738, 10148, 0, 123, 274, 0, 1246 }, false, 0, 0 },
+    { 1767317100, -549, { 206, 213, 1209, 723, 10149, 0, 130, 287, 0, 1249 }, false, 0, 0 },
+    { 1767317400, -578, { 232, 165, 1207, 733, 10145, 0, 131, 265, 0, 1247 }, false, 0, 0 },
+    { 1767317700, -48, { 170, 184, 1208, 746, 10147, 0, 130, 277, 0, 1248 }, false, 0, 0 },
+    { 1767318000, -228, { 118, 208, 1209, 722, 10146, 0, 85, 299, 0, 1249 }, false, 0, 0 },
+    { 1767318300, -159, { 170, 190, 1207, 709, 10144, 0, 124, 283, 0, 1247 }, false, 0, 0 },
+    { 1767318600, -7, { 167, 176, 1209, 732, 10144, 0, 96, 272, 0, 1249 }, false, 0, 0 },
+    { 1767318900, -527, { 178, 186, 1209, 720, 10143, 0, 76, 276, 0, 1249 }, false, 0, 0 },
+    { 1767319200, -518, { 171, 210, 1222, 699, 10143, 0, 93, 312, 0, 1262 }, false, 0, 0 },
+    { 1767319500, -530, { 153, 185, 1220, 680, 10144, 0, 111, 282, 0, 1260 }, false, 0, 0 },
+    { 1767319800, -226, { 129, 175, 1222, 699, 10144, 0, 95, 269, 0, 1262 }, false, 0, 0 },
+    { 1767320100, -235, { 198, 190, 1226, 682, 10143, 0, 155, 296, 0, 1266 }, false, 0, 0 },
+    { 1767320400, -401, { 172, 194, 1219, 705, 10142, 0, 130, 283, 0, 1259 }, false, 0, 0 },
+    { 1767320700, -76, { 248, 191, 1219, 667, 10141, 0, 168, 274, 0, 1259 }, false, 0, 0 },
+    { 1767321000, -175, { 271, 224, 1224, 701, 10141, 0, 171, 295, 0, 1264 }, false, 0, 0 },
+    { 1767321300, -485, { 198, 215, 1222, 674, 10138, 0, 127, 300, 0, 1262 }, false, 0, 0 },
+    { 1767321600, -316, { 210, 206, 1222, 693, 10137, 0, 114, 281, 0, 1262 }, false, 0, 0 },
+    { 1767321900, -215, { 270, 185, 1223, 690, 10134, 0, 177, 278, 0, 1263 }, false, 0, 0 },
+    { 1767322200, -342, { 221, 202, 1222, 696, 10136, 0, 162, 303, 0, 1262 }, false, 0, 0 },
+    { 1767322500, -210, { 303, 217, 1222, 680, 10139, 0, 207, 307, 0, 1262 }, false, 0, 0 },
+    { 1767322800, -10, { 333, 203, 1230, 678, 10141, 0, 217, 291, 0, 1270 }, false, 0, 0 },
+    { 1767323100, -287, { 279, 242, 1232, 655, 10142, 0, 212, 313, 0, 1272 }, false, 0, 0 },
+    { 1767323400, -554, { 315, 200, 1232, 652, 10144, 0, 211, 303, 0, 1272 }, false, 0, 0 },
+    { 1767323700, -91, { 252, 200, 1230, 705, 10145, 0, 155, 289, 0, 1270 }, false, 0, 0 },
+    { 1767324000, -496, { 180, 230, 1232, 660, 10145, 0, 125, 336, 0, 1272 }, false, 0, 0 },
+    { 1767324300, -459, { 215, 219, 1232, 662, 10144, 0, 166, 302, 0, 1272 }, false, 0, 0 },
+    { 1767324600, -408, { 226, 236, 1230, 681, 10143, 0, 174, 311, 0, 1270 }, false, 0, 0 },
+    { 1767324900, -591, { 244, 214, 1234, 673, 10144, 0, 180, 300, 0, 1274 }, false, 0, 0 },
+    { 1767325200, -179, { 248, 196, 1231, 668, 10141, 0, 193, 303, 0, 1271 }, false, 0, 0 },
+    { 1767325500, -256, { 273, 192, 1231, 666, 10139, 0, 170, 290, 0, 1271 }, false, 0, 0 },
+    { 1767325800, -272, { 273, 196, 1231, 670, 10137, 0, 167, 283, 0, 1271 }, false, 0, 0 },
+    { 1767326100, -224, { 232, 214, 1230, 662, 10137, 0, 139, 314, 0, 1270 }, false, 0, 0 },
+    { 1767326400, -33, { 192, 216, 1238, 650, 10137, 0, 145, 317, 0, 1278 }, false, 0, 0 },
+    { 1767326700, -270, { 216, 217, 1237, 651, 10133, 0, 125, 297, 0, 1277 }, false, 0, 0 },
+    { 1767327000, -464, { 223, 219, 1236, 646, 10131, 0, 164, 310, 0, 1276 }, false, 0, 0 },
+    { 1767327300, -375, { 214, 249, 1239, 665, 10132, 0, 123, 321, 0, 1279 }, false, 0, 0 },
+    { 1767327600, -164, { 157, 226, 1233, 648, 10131, 0, 108, 315, 0, 1273 }, false, 0, 0 },
+    { 1767327900, -489, { 196, 218, 1240, 648, 10130, 0, 145, 304, 0, 1280 }, false, 0, 0 },
+    { 1767328200, -170, { 159, 238, 1237, 661, 10131, 0, 102, 324, 0, 1277 }, false, 0, 0 },
+    { 1767328500, -13, { 193, 209, 1236, 661, 10129, 0, 127, 319, 0, 1276 }, false, 0, 0 },
+    { 1767328800, -160, { 227, 231, 1239, 665, 10127, 0, 175, 304, 0, 1279 }, false, 0, 0 },
+    { 1767329100, -501, { 221, 190, 1234, 677, 10129, 0, 164, 289, 0, 1274 }, false, 0, 0 },
+    { 1767329400, -150, { 258, 264, 1239, 639, 10126, 0, 162, 339, 0, 1279 }, false, 0, 0 },
+    { 1767329700, -480, { 275, 223, 1237, 657, 10127, 0, 177, 306, 0, 1277 }, false, 0, 0 },
+    { 1767330000, -445, { 182, 245, 1241, 624, 10128, 0, 108, 328, 0, 1281 }, false, 0, 0 },
+    { 1767330300, -474, { 241, 246, 1238, 644, 10129, 0, 82, 346, 0, 1278 }, false, 0, 0 },
+    { 1767330600, -213, { 165, 229, 1241, 636, 10128, 0, 118, 331, 0, 1281 }, false, 0, 0 },
+    { 1767330900, -63, { 181, 236, 1238, 655, 10127, 0, 108, 322, 0, 1278 }, false, 0, 0 },
+    { 1767331200, -333, { 147, 235, 1243, 655, 10128, 0, 116, 319, 0, 1283 }, false, 0, 0 },
+    { 1767331500, -562, { 203, 251, 1240, 633, 10129, 0, 143, 334, 0, 1280 }, false, 0, 0 },
+    { 1767331800, -44, { 113, 273, 1240, 651, 10131, 0, 74, 371, 0, 1280 }, false, 0, 0 },
+    { 1767332100, -391, { 107, 205, 1238, 674, 10130, 0, 58, 310, 0, 1278 }, false, 0, 0 },
+    { 1767332400, -492, { 143, 224, 1240, 648, 10129, 0, 101, 322, 0, 1280 }, false, 0, 0 },
+    { 1767332700, -518, { 217, 237, 1240, 657, 10130, 0, 96, 332, 0, 1280 }, false, 0, 0 },
+    { 1767333000, -322, { 192, 214, 1236, 636, 10130, 0, 156, 319, 0, 1276 }, false, 0, 0 },
+    { 1767333300, -327, { 203, 266, 1240, 644, 10128, 0, 99, 354, 0, 1280 }, false, 0, 0 },
+    { 1767333600, -291, { 167, 196, 1239, 656, 10126, 0, 105, 293, 0, 1279 }, false, 0, 0 },
+    { 1767333900, -224, { 144, 213, 1236, 660, 10125, 0, 82, 302, 0, 1276 }, false, 0, 0 },
+    { 1767334200, -37, { 229, 209, 1239, 647, 10126, 0, 168, 302, 0, 1279 }, false, 0, 0 },
+    { 1767334500, -423, { 196, 236, 1238, 673, 10124, 0, 127, 324, 0, 1278 }, false, 0, 0 },
+    { 1767334800, -530, { 165, 264, 1237, 676, 10124, 0, 116, 337, 0, 1277 }, false, 0, 0 },
+    { 1767335100, -358, { 218, 225, 1236, 664, 10124, 0, 122, 331, 0, 1276 }, false, 0, 0 },
+    { 1767335400, -142, { 160, 246, 1237, 648, 10128, 0, 106, 317, 0, 1277 }, false, 0, 0 },
+    { 1767335700, -279, { 260, 239, 1236, 661, 10125, 0, 165, 327, 0, 1276 }, false, 0, 0 },
+    { 1767336000, -316, { 233, 229, 1238, 654, 10126, 0, 131, 331, 0, 1278 }, false, 0, 0 },
+    { 1767336300, -54, { 187, 244, 1235, 663, 10127, 0, 133, 323, 0, 1275 }, false, 0, 0 },
+    { 1767336600, -401, { 187, 251, 1239, 651, 10127, 0, 97, 322, 0, 1279 }, false, 0, 0 },
+    { 1767336900, -355, { 152, 248, 1239, 660, 10127, 0, 99, 353, 0, 1279 }, false, 0, 0 },
+    { 1767337200, -84, { 118, 225, 1234, 676, 10129, 0, 79, 308, 0, 1274 }, false, 0, 0 },
+    { 1767337500, -467, { 144, 255, 1227, 687, 10127, 0, 94, 338, 0, 1267 }, false, 0, 0 },
+    { 1767337800, -72, { 135, 212, 1230, 677, 10127, 0, 79, 310, 0, 1270 }, false, 0, 0 },
+    { 1767338100, -143, { 140, 231, 1233, 665, 10127, 0, 92, 329, 0, 1273 }, false, 0, 0 },
+    { 1767338400, -114, { 198, 274, 1233, 677, 10126, 0, 117, 373, 0, 1273 }, false, 0, 0 },
+    { 1767338700, -384, { 128, 183, 1231, 664, 10124, 0, 95, 288, 0, 1271 }, false, 0, 0 },
+    { 1767339000, -370, { 167, 254, 1232, 667, 10124, 0, 118, 330, 0, 1272 }, false, 0, 0 },
+    { 1767339300, -240, { 224, 203, 1231, 672, 10124, 0, 125, 313, 0, 1271 }, false, 0, 0 },
+    { 1767339600, -557, { 191, 230, 1231, 682, 10124, 0, 137, 323, 0, 1271 }, false, 0, 0 },
+    { 1767339900, -469, { 221, 217, 1232, 668, 10125, 0, 152, 325, 0, 1272 }, false, 0, 0 },
+    { 1767340200, -494, { 194, 222, 1231, 662, 10125, 0, 144, 314, 0, 1271 }, false, 0, 0 },
+    { 1767340500, -72, { 218, 233, 1230, 672, 10123, 0, 161, 330, 0, 1270 }, false, 0, 0 },
+    { 1767340800, -215, { 279, 252, 1222, 692, 10124, 0, 185, 333, 0, 1262 }, false, 0, 0 },
+    { 1767341100, -189, { 222, 252, 1220, 707, 10126, 0, 174, 324, 0, 1260 }, false, 0, 0 },
+    { 1767341400, -274, { 205, 282, 1218, 698, 10127, 0, 139, 362, 0, 1258 }, false, 0, 0 },
+    { 1767341700, -431, { 277, 239, 1217, 702, 10128, 0, 166, 346, 0, 1257 }, false, 0, 0 },
+    { 1767342000, -69, { 278, 261, 1224, 681, 10130, 0, 190, 339, 0, 1264 }, false, 0, 0 },
+    { 1767342300, -21, { 207, 240, 1222, 697, 10130, 0, 139, 322, 0, 1262 }, false, 0, 0 },
+    { 1767342600, -208, { 210, 256, 1221, 703, 10128, 0, 145, 337, 0, 1261 }, false, 0, 0 },
+    { 1767342900, -294, { 234, 246, 1220, 696, 10127, 0, 164, 323, 0, 1260 }, false, 0, 0 },
+    { 1767343200, -254, { 291, 253, 1222, 692, 10130, 0, 226, 337, 0, 1262 }, false, 0, 0 },
+    { 1767343500, -299, { 286, 254, 1224, 685, 10128, 0, 207, 326, 0, 1264 }, false, 0, 0 },
+    { 1767343800, -428, { 313, 265, 1218, 703, 10128, 0, 195, 340, 0, 1258 }, false, 0, 0 },
+    { 1767344100, -325, { 339, 207, 1225, 698, 10129, 0, 233, 298, 0, 1265 }, false, 0, 0 },
+    { 1767344400, -280, { 296, 250, 1211, 727, 10134, 0, 217, 350, 0, 1251 }, false, 0, 0 },
+    { 1767344700, -482, { 330, 244, 1215, 702, 10132, 0, 250, 344, 0, 1255 }, false, 0, 0 },
+    { 1767345000, -475, { 349, 218, 1209, 742, 10131, 0, 269, 327, 0, 1249 }, false, 0, 0 },
+    { 1767345300, -362, { 365, 258, 1210, 725, 10129, 0, 256, 331, 0, 1250 }, false, 0, 0 },
+    { 1767345600, -442, { 329, 258, 1209, 729, 10131, 0, 234, 328, 0, 1249 }, false, 0, 0 },
+    { 1767345900, -202, { 399, 195, 1207, 722, 10131, 0, 278, 300, 0, 1247 }, false, 0, 0 },
+    { 1767346200, -162, { 343, 250, 1212, 721, 10130, 0, 199, 350, 0, 1252 }, false, 0, 0 },
+    { 1767346500, -372, { 273, 227, 1209, 725, 10130, 0, 203, 304, 0, 1249 }, false, 0, 0 },
+    { 1767346800, -153, { 295, 206, 1208, 716, 10131, 24, 202, 303, 2, 1248 }, true, 114, -137 },
+    { 1767347100, -557, { 232, 234, 1208, 729, 10127, 72, 169, 312, 8, 1248 }, true, 223, -446 },
+    { 1767347400, -143, { 325, 254, 1211, 722, 10126, 96, 177, 336, 16, 1251 }, true, 253, -158 },
+    { 1767347700, -501, { 295, 233, 1211, 724, 10125, 96, 181, 322, 24, 1251 }, true, 249, -66 },
+    { 1767348000, -76, { 325, 236, 1198, 741, 10124, 120, 191, 341, 34, 1238 }, true, 356, -134 },
+    { 1767348300, -419, { 318, 205, 1194, 773, 10124, 24, 200, 310, 36, 1234 }, true, 82, -118 },
+    { 1767348600, -417, { 326, 257, 1198, 762, 10121, 24, 205, 329, 38, 1238 }, true, 105, -216 },
+    { 1767348900, -317, { 264, 211, 1196, 767, 10124, 48, 199, 312, 42, 1236 }, true, 148, -53 },
+    { 1767349200, -239, { 303, 234, 1189, 778, 10125, 0, 215, 328, 42, 1229 }, false, 0, 0 },
+    { 1767349500, -241, { 282, 226, 1196, 765, 10121, 144, 206, 326, 54, 1236 }, true, 409, -179 },
+    { 1767349800, -174, { 285, 215, 1196, 773, 10121, 120, 203, 308, 64, 1236 }, true, 352, -97 },
+    { 1767350100, -123, { 287, 225, 1196, 761, 10122, 96, 204, 316, 72, 1236 }, true, 273, -102 },
+    { 1767350400, -7, { 316, 239, 1199, 743, 10122, 72, 192, 331, 78, 1239 }, true, 224, -480 },
+    { 1767350700, -141, { 259, 241, 1194, 744, 10122, 24, 185, 324, 80, 1234 }, true, 104, -203 },
+    { 1767351000, -217, { 291, 241, 1193, 755, 10122, 0, 215, 324, 80, 1233 }, false, 0, 0 },
+    { 1767351300, -208, { 310, 221, 1194, 753, 10123, 0, 191, 315, 80, 1234 }, false, 0, 0 },
+    { 1767351600, -335, { 266, 205, 1178, 821, 10125, 24, 200, 309, 82, 1218 }, true, 113, -5 },
+    { 1767351900, -383, { 370, 219, 1181, 804, 10124, 120, 257, 315, 92, 1221 }, true, 301, -255 },
+    { 1767352200, -579, { 333, 228, 1183, 786, 10123, 24, 229, 314, 94, 1223 }, true, 113, -502 },
+    { 1767352500, -387, { 306, 238, 1176, 829, 10123, 24, 227, 323, 96, 1216 }, true, 97, -360 },
+    { 1767352800, -294, { 344, 209, 1181, 796, 10124, 48, 244, 296, 100, 1221 }, true, 167, -336 },
+    { 1767353100, -523, { 344, 239, 1181, 816, 10124, 144, 250, 319, 112, 1221 }, true, 377, -53 },
+    { 1767353400, -174, { 356, 224, 1182, 793, 10121, 24, 232, 302, 114, 1222 }, true, 62, -410 },
+    { 1767353700, -245, { 264, 222, 1179, 799, 10122, 48, 179, 315, 118, 1219 }, true, 156, -188 },
+    { 1767354000, -507, { 302, 247, 1179, 804, 10121, 96, 232, 324, 126, 1219 }, true, 286, -45 },
+    { 1767354300, -63, { 307, 234, 1177, 804, 10122, 0, 217, 326, 126, 1217 }, false, 0, 0 },
+    { 1767354600, -422, { 298, 267, 1178, 833, 10122, 0, 220, 344, 126, 1218 }, false, 0, 0 },
+    { 1767354900, -471, { 287, 220, 1180, 811, 10121, 0, 220, 305, 126, 1220 }, false, 0, 0 },
+    { 1767355200, -210, { 260, 246, 1166, 823, 10119, 0, 194, 318, 126, 1206 }, false, 0, 0 },
+    { 1767355500, -319, { 349, 241, 1161, 839, 10118, 0, 222, 335, 126, 1201 }, false, 0, 0 },
+    { 1767355800, -422, { 298, 221, 1166, 823, 10118, 0, 208, 322, 126, 1206 }, false, 0, 0 },
+    { 1767356100, -505, { 389, 224, 1165, 836, 10116, 0, 221, 312, 126, 1205 }, false, 0, 0 },
+    { 1767356400, -341, { 313, 208, 1164, 838, 10114, 0, 219, 314, 126, 1204 }, false, 0, 0 },
+    { 1767356700, -491, { 313, 225, 1163, 847, 10112, 0, 221, 313, 126, 1203 }, false, 0, 0 },
+    { 1767357000, -329, { 314, 217, 1167, 835, 10113, 0, 214, 318, 126, 1207 }, false, 0, 0 },
+    { 1767357300, -158, { 364, 219, 1165, 853, 10115, 0, 246, 298, 126, 1205 }, false, 0, 0 },
+    { 1767357600, -446, { 378, 199, 1164, 823, 10116, 0, 280, 304, 126, 1204 }, false, 0, 0 },
+    { 1767357900, -284, { 448, 200, 1165, 828, 10120, 0, 287, 303, 126, 1205 }, false, 0, 0 },
+    { 1767358200, -17, { 465, 208, 1166, 832, 10120, 0, 336, 302, 126, 1206 }, false, 0, 0 },
+    { 1767358500, -320, { 363, 195, 1166, 825, 10119, 0, 266, 305, 126, 1206 }, false, 0, 0 },
+    { 1767358800, -288, { 370, 232, 1150, 872, 10123, 0, 277, 320, 126, 1190 }, false, 0, 0 },
+    { 1767359100, -481, { 388, 229, 1150, 870, 10125, 0, 291, 316, 126, 1190 }, false, 0, 0 },
+    { 1767359400, -511, { 373, 223, 1147, 883, 10125, 0, 272, 312, 126, 1187 }, false, 0, 0 },
+    { 1767359700, -559, { 326, 189, 1150, 876, 10126, 0, 244, 292, 126, 1190 }, false, 0, 0 },
+    { 1767360000, -98, { 373, 192, 1149, 859, 10125, 0, 287, 275, 126, 1189 }, false, 0, 0 },
+    { 1767360300, -596, { 367, 235, 1152, 870, 10124, 0, 267, 310, 126, 1192 }, false, 0, 0 },
+    { 1767360600, -446, { 384, 198, 1149, 868, 10123, 0, 272, 280, 126, 1189 }, false, 0, 0 },
+    { 1767360900, -44, { 362, 197, 1147, 889, 10124, 0, 267, 301, 126, 1187 }, false, 0, 0 },
+    { 1767361200, -17, { 360, 226, 1153, 859, 10124, 0, 272, 309, 126, 1193 }, false, 0, 0 },
+    { 1767361500, -321, { 362, 215, 1148, 886, 10124, 0, 278, 317, 126, 1188 }, false, 0, 0 },
+    { 1767361800, -203, { 342, 201, 1148, 884, 10124, 0, 251, 310, 126, 1188 }, false, 0, 0 },
+    { 1767362100, -388, { 349, 170, 1150, 862, 10123, 0, 231, 263, 126, 1190 }, false, 0, 0 },
+    { 1767362400, -251, { 327, 231, 1136, 892, 10120, 0, 214, 314, 126, 1176 }, false, 0, 0 },
+    { 1767362700, -93, { 331, 231, 1137, 886, 10123, 0, 244, 319, 126, 1177 }, false, 0, 0 },
+    { 1767363000, -499, { 395, 211, 1139, 905, 10122, 0, 263, 301, 126, 1179 }, false, 0, 0 },
+    { 1767363300, -171, { 397, 249, 1137, 896, 10121, 0, 290, 319, 126, 1177 }, false, 0, 0 },
+    { 1767363600, -567, { 361, 231, 1140, 908, 10121, 0, 271, 312, 126, 1180 }, false, 0, 0 },
+    { 1767363900, -600, { 405, 240, 1134, 924, 10119, 0, 294, 331, 126, 1174 }, false, 0, 0 },
+    { 1767364200, -365, { 440, 217, 1139, 894, 10119, 0, 289, 313, 126, 1179 }, false, 0, 0 },
+    { 1767364500, -256, { 416, 228, 1141, 892, 10119, 0, 261, 338, 126, 1181 }, false, 0, 0 },
+    { 1767364800, -470, { 565, 219, 1134, 908, 10120, 0, 370, 311, 126, 1174 }, false, 0, 0 },
+    { 1767365100, -175, { 390, 243, 1138, 894, 10123, 0, 256, 325, 126, 1178 }, false, 0, 0 },
+    { 1767365400, -534, { 352, 195, 1136, 908, 10123, 0, 264, 302, 126, 1176 }, false, 0, 0 },
+    { 1767365700, -271, { 411, 199, 1137, 893, 10125, 0, 306, 302, 126, 1177 }, false, 0, 0 },
+    { 1767366000, -253, { 368, 188, 1127, 931, 10125, 0, 281, 297, 126, 1167 }, false, 0, 0 },
+    { 1767366300, -378, { 284, 195, 1127, 926, 10123, 0, 212, 296, 126, 1167 }, false, 0, 0 },
+    { 1767366600, -241, { 324, 183, 1129, 942, 10121, 0, 241, 288, 126, 1169 }, false, 0, 0 },
+    { 1767366900, -317, { 325, 163, 1127, 942, 10119, 0, 201, 266, 126, 1167 }, false, 0, 0 },
+    { 1767367200, -390, { 380, 161, 1126, 923, 10121, 0, 294, 262, 126, 1166 }, false, 0, 0 },
+    { 1767367500, -368, { 421, 213, 1123, 939, 10120, 0, 258, 294, 126, 1163 }, false, 0, 0 },
+    { 1767367800, -200, { 402, 213, 1127, 934, 10116, 0, 262, 285, 126, 1167 }, false, 0, 0 },
+    { 1767368100, -56, { 410, 191, 1130, 921, 10117, 0, 298, 272, 126, 1170 }, false, 0, 0 },
+    { 1767368400, -121, { 384, 188, 1130, 933, 10118, 0, 272, 278, 126, 1170 }, false, 0, 0 },
+    { 1767368700, -29, { 438, 181, 1128, 930, 10120, 0, 287, 267, 126, 1168 }, false, 0, 0 },
+    { 1767369000, -535, { 379, 206, 1127, 937, 10120, 0, 259, 302, 126, 1167 }, false, 0, 0 },
+    { 1767369300, -266, { 405, 188, 1128, 912, 10119, 0, 273, 297, 126, 1168 }, false, 0, 0 },
+    { 1767369600, -413, { 370, 192, 1120, 946, 10122, 0, 284, 299, 126, 1160 }, false, 0, 0 },
+    { 1767369900, -364, { 378, 176, 1115, 954, 10122, 0, 262, 270, 126, 1155 }, false, 0, 0 },
+    { 1767370200, -192, { 436, 238, 1118, 963, 10122, 0, 242, 312, 126, 1158 }, false, 0, 0 },
+    { 1767370500, -370, { 376, 205, 1123, 970, 10123, 0, 258, 293, 126, 1163 }, false, 0, 0 },
+    { 1767370800, -131, { 405, 199, 1121, 937, 10123, 0, 306, 287, 126, 1161 }, false, 0, 0 },
+    { 1767371100, -14, { 350, 217, 1120, 930, 10122, 0, 236, 294, 126, 1160 }, false, 0, 0 },
+    { 1767371400, -148, { 355, 168, 1123, 959, 10119, 0, 257, 263, 126, 1163 }, false, 0, 0 },
+    { 1767371700, -186, { 373, 174, 1122, 943, 10119, 0, 244, 260, 126, 1162 }, false, 0, 0 },
+    { 1767372000, -84, { 396, 165, 1125, 935, 10117, 0, 276, 272, 126, 1165 }, false, 0, 0 },
+    { 1767372300, -401, { 422, 206, 1123, 935, 10118, 0, 301, 284, 126, 1163 }, false, 0, 0 },
+    { 1767372600, -204, { 423, 187, 1120, 940, 10119, 0, 263, 267, 126, 1160 }, false, 0, 0 },
+    { 1767372900, -197, { 380, 177, 1125, 942, 10121, 0, 284, 285, 126, 1165 }, false, 0, 0 },
+    { 1767373200, -446, { 379, 200, 1120, 949, 10121, 0, 258, 280, 126, 1160 }, false, 0, 0 },
+    { 1767373500, -34, { 405, 144, 1119, 947, 10123, 0, 281, 240, 126, 1159 }, false, 0, 0 },
+    { 1767373800, -392, { 331, 183, 1119, 947, 10125, 0, 255, 258, 126, 1159 }, false, 0, 0 },
+    { 1767374100, -258, { 357, 147, 1120, 950, 10124, 0, 245, 257, 126, 1160 }, false, 0, 0 },
+    { 1767374400, -400, { 331, 147, 1120, 938, 10123, 0, 236, 253, 126, 1160 }, false, 0, 0 },
+    { 1767374700, -505, { 391, 202, 1119, 951, 10123, 0, 276, 281, 126, 1159 }, false, 0, 0 },
+    { 1767375000, -463, { 375, 152, 1118, 950, 10122, 0, 283, 253, 126, 1158 }, false, 0, 0 },
+    { 1767375300, -589, { 358, 181, 1121, 945, 10123, 0, 244, 286, 126, 1161 }, false, 0, 0 },
+    { 1767375600, -84, { 461, 156, 1117, 957, 10125, 0, 323, 265, 126, 1157 }, false, 0, 0 },
+    { 1767375900, -256, { 435, 202, 1120, 940, 10122, 0, 318, 275, 126, 1160 }, false, 0, 0 },
+    { 1767376200, -511, { 426, 172, 1120, 938, 10124, 0, 310, 274, 126, 1160 }, false, 0, 0 },
+    { 1767376500, -600, { 454, 154, 1120, 959, 10124, 0, 331, 252, 126, 1160 }, false, 0, 0 },
+    { 1767376800, -150, { 485, 181, 1119, 957, 10123, 0, 372, 256, 126, 1159 }, false, 0, 0 },
+    { 1767377100, -90, { 522, 220, 1120, 964, 10124, 0, 349, 302, 126, 1160 }, false, 0, 0 },
+    { 1767377400, -234, { 444, 191, 1120, 979, 10126, 0, 343, 288, 126, 1160 }, false, 0, 0 },
+    { 1767377700, -240, { 483, 191, 1124, 940, 10123, 0, 314, 278, 126, 1164 }, false, 0, 0 },
+    { 1767378000, -47, { 468, 173, 1118, 936, 10125, 0, 309, 269, 126, 1158 }, false, 0, 0 },
+    { 1767378300, -60, { 443, 165, 1122, 947, 10126, 0, 320, 250, 126, 1162 }, false, 0, 0 },
+    { 1767378600, -482, { 477, 174, 1123, 956, 10127, 0, 328, 261, 126, 1163 }, false, 0, 0 },
+    { 1767378900, -431, { 443, 166, 1121, 936, 10126, 0, 285, 242, 126, 1161 }, false, 0, 0 },
+    { 1767379200, -262, { 409, 130, 1124, 944, 10126, 0, 292, 238, 126, 1164 }, false, 0, 0 },
+    { 1767379500, -553, { 451, 189, 1123, 949, 10125, 0, 334, 281, 126, 1163 }, false, 0, 0 },
+    { 1767379800, -403, { 385, 180, 1125, 926, 10124, 0, 279, 269, 126, 1165 }, false, 0, 0 },
+    { 1767380100, -457, { 336, 169, 1125, 941, 10125, 0, 243, 254, 126, 1165 }, false, 0, 0 },
+    { 1767380400, -522, { 416, 199, 1128, 929, 10125, 0, 255, 274, 126, 1168 }, false, 0, 0 },
+    { 1767380700, -250, { 361, 197, 1130, 928, 10126, 0, 251, 278, 126, 1170 }, false, 0, 0 },
+    { 1767381000, -139, { 328, 183, 1130, 911, 10126, 0, 246, 262, 126, 1170 }, false, 0, 0 },
+    { 1767381300, -540, { 361, 181, 1125, 938, 10128, 0, 255, 265, 126, 1165 }, false, 0, 0 },
+    { 1767381600, -296, { 351, 170, 1130, 921, 10129, 0, 264, 248, 126, 1170 }, false, 0, 0 },
+    { 1767381900, -216, { 324, 163, 1129, 930, 10128, 0, 238, 241, 126, 1169 }, false, 0, 0 },
+    { 1767382200, -404, { 355, 163, 1124, 941, 10128, 0, 252, 268, 126, 1164 }, false, 0, 0 },
+    { 1767382500, -552, { 368, 136, 1128, 933, 10129, 0, 249, 233, 126, 1168 }, false, 0, 0 },
+    { 1767382800, -474, { 354, 162, 1132, 913, 10129, 0, 253, 251, 126, 1172 }, false, 0, 0 },
+    { 1767383100, -195, { 320, 172, 1126, 949, 10128, 0, 245, 245, 126, 1166 }, false, 0, 0 },
+    { 1767383400, -80, { 330, 149, 1129, 911, 10127, 0, 223, 256, 126, 1169 }, false, 0, 0 },
+    { 1767383700, -35, { 288, 127, 1132, 920, 10126, 0, 202, 237, 126, 1172 }, false, 0, 0 },
+    { 1767384000, -291, { 335, 169, 1135, 906, 10127, 0, 230, 260, 126, 1175 }, false, 0, 0 },
+    { 1767384300, -142, { 370, 164, 1137, 892, 10128, 0, 262, 257, 126, 1177 }, false, 0, 0 },
+    { 1767384600, -543, { 252, 159, 1135, 918, 10128, 0, 166, 255, 126, 1175 }, false, 0, 0 },
+    { 1767384900, -351, { 264, 160, 1137, 902, 10126, 0, 195, 245, 126, 1177 }, false, 0, 0 },
+    { 1767385200, -436, { 321, 186, 1134, 901, 10129, 0, 238, 262, 126, 1174 }, false, 0, 0 },
+    { 1767385500, -143, { 270, 165, 1136, 913, 10130, 0, 183, 271, 126, 1176 }, false, 0, 0 },
+    { 1767385800, -308, { 274, 171, 1141, 898, 10132, 0, 205, 255, 126, 1181 }, false, 0, 0 },
+    { 1767386100, -437, { 279, 148, 1139, 881, 10128, 0, 186, 244, 126, 1179 }, false, 0, 0 },
+    { 1767386400, -265, { 309, 153, 1139, 902, 10124, 0, 190, 245, 126, 1179 }, false, 0, 0 },
+    { 1767386700, -560, { 250, 170, 1137, 896, 10124, 0, 193, 268, 126, 1177 }, false, 0, 0 },
+    { 1767387000, -443, { 281, 169, 1139, 906, 10126, 0, 184, 239, 126, 1179 }, false, 0, 0 },
+    { 1767387300, -17, { 265, 153, 1136, 915, 10125, 0, 195, 259, 126, 1176 }, false, 0, 0 },
+    { 1767387600, -251, { 243, 167, 1149, 882, 10124, 0, 161, 274, 126, 1189 }, false, 0, 0 },
+    { 1767387900, -501, { 229, 174, 1150, 859, 10124, 48, 133, 244, 130, 1190 }, true, 120, -478 },
+    { 1767388200, -300, { 272, 153, 1149, 885, 10124, 96, 209, 249, 138, 1189 }, true, 265, -508 },
+    { 1767388500, -503, { 229, 161, 1151, 875, 10123, 24, 136, 245, 140, 1191 }, true, 80, -6 },
+    { 1767388800, -37, { 232, 141, 1148, 872, 10124, 120, 179, 242, 150, 1188 }, true, 303, -316 },
+    { 1767389100, -134, { 252, 164, 1149, 880, 10125, 48, 195, 255, 154, 1189 }, true, 170, -187 },
+    { 1767389400, -298, { 226, 173, 1151, 875, 10123, 120, 151, 251, 164, 1191 }, true, 348, -217 },
+    { 1767389700, -572, { 203, 157, 1150, 890, 10123, 72, 128, 239, 170, 1190 }, true, 209, -593 },
+    { 1767390000, -210, { 239, 155, 1150, 870, 10123, 0, 190, 254, 170, 1190 }, false, 0, 0 },
+    { 1767390300, -157, { 240, 170, 1148, 882, 10121, 144, 160, 240, 182, 1188 }, true, 408, -119 },
+    { 1767390600, -255, { 261, 181, 1149, 882, 10120, 0, 166, 252, 182, 1189 }, false, 0, 0 },
+    { 1767390900, -309, { 225, 159, 1150, 869, 10120, 96, 164, 261, 190, 1190 }, true, 274, -60 },
+    { 1767391200, -547, { 209, 162, 1161, 850, 10120, 96, 136, 272, 198, 1201 }, true, 243, -70 },
+    { 1767391500, -18, { 161, 171, 1164, 823, 10118, 120, 109, 264, 208, 1204 }, true, 322, -459 },
+    { 1767391800, -229, { 239, 144, 1165, 838, 10119, 120, 171, 245, 218, 1205 }, true, 331, -125 },
+    { 1767392100, -99, { 260, 150, 1162, 854, 10121, 48, 170, 241, 222, 1202 }, true, 125, -119 },
+    { 1767392400, -545, { 208, 178, 1164, 834, 10119, 72, 109, 259, 228, 1204 }, true, 217, -153 },
+    { 1767392700, -331, { 132, 172, 1163, 849, 10120, 0, 102, 266, 228, 1203 }, false, 0, 0 },
+    { 1767393000, -259, { 134, 140, 1162, 841, 10122, 0, 92, 248, 228, 1202 }, false, 0, 0 },
+    { 1767393300, -83, { 156, 185, 1163, 830, 10120, 0, 107, 263, 228, 1203 }, false, 0, 0 },
+    { 1767393600, -131, { 202, 137, 1164, 826, 10116, 0, 109, 239, 228, 1204 }, false, 0, 0 },
+    { 1767393900, -190, { 280, 171, 1165, 859, 10115, 0, 145, 268, 228, 1205 }, false, 0, 0 },
+    { 1767394200, -285, { 218, 174, 1164, 824, 10115, 0, 129, 267, 228, 1204 }, false, 0, 0 },
+    { 1767394500, -511, { 174, 131, 1166, 836, 10117, 0, 121, 234, 228, 1206 }, false, 0, 0 },
+    { 1767394800, -229, { 228, 195, 1178, 806, 10115, 0, 161, 272, 0, 1218 }, false, 0, 0 },
+    { 1767395100, -393, { 203, 143, 1181, 808, 10116, 0, 158, 238, 0, 1221 }, false, 0, 0 },
+    { 1767395400, -590, { 175, 201, 1179, 805, 10114, 0, 134, 276, 0, 1219 }, false, 0, 0 },
+    { 1767395700, -481, { 245, 183, 1180, 793, 10115, 0, 127, 263, 0, 1220 }, false, 0, 0 },
+    { 1767396000, -15, { 147, 179, 1181, 783, 10115, 0, 106, 274, 0, 1221 }, false, 0, 0 },
+    { 1767396300, -415, { 257, 185, 1179, 797, 10115, 0, 132, 268, 0, 1219 }, false, 0, 0 },
+    { 1767396600, -193, { 205, 187, 1179, 802, 10116, 0, 106, 265, 0, 1219 }, false, 0, 0 },
+    { 1767396900, -307, { 140, 206, 1178, 825, 10117, 0, 94, 279, 0, 1218 }, false, 0, 0 },
+    { 1767397200, -392, { 170, 188, 1184, 801, 10116, 0, 116, 258, 0, 1224 }, false, 0, 0 },
+    { 1767397500, -93, { 193, 138, 1176, 811, 10116, 0, 85, 246, 0, 1216 }, false, 0, 0 },
+    { 1767397800, -557, { 185, 168, 1181, 799, 10117, 0, 113, 254, 0, 1221 }, false, 0, 0 },
+    { 1767398100, -585, { 104, 181, 1180, 778, 10119, 0, 61, 256, 0, 1220 }, false, 0, 0 },
+    { 1767398400, -180, { 151, 141, 1195, 758, 10120, 0, 80, 244, 0, 1235 }, false, 0, 0 },
+    { 1767398700, -245, { 100, 130, 1192, 762, 10119, 0, 60, 224, 0, 1232 }, false, 0, 0 },
+    { 1767399000, -165, { 156, 179, 1194, 771, 10122, 0, 110, 249, 0, 1234 }, false, 0, 0 },
+    { 1767399300, -54, { 150, 172, 1195, 747, 10121, 0, 95, 271, 0, 1235 }, false, 0, 0 },
+    { 1767399600, -366, { 104, 168, 1196, 757, 10123, 0, 56, 245, 0, 1236 }, false, 0, 0 },
+    { 1767399900, -248, { 252, 149, 1195, 778, 10121, 0, 128, 255, 0, 1235 }, false, 0, 0 },
+    { 1767400200, -530, { 150, 152, 1194, 774, 10120, 0, 71, 262, 0, 1234 }, false, 0, 0 },
+    { 1767400500, -448, { 148, 173, 1194, 763, 10120, 0, 101, 245, 0, 1234 }, false, 0, 0 },
+    { 1767400800, -136, { 97, 158, 1197, 769, 10123, 0, 54, 264, 0, 1237 }, false, 0, 0 },
+    { 1767401100, -220, { 236, 176, 1194, 771, 10122, 0, 129, 286, 0, 1234 }, false, 0, 0 },
+    { 1767401400, -387, { 135, 183, 1198, 740, 10123, 0, 80, 287, 0, 1238 }, false, 0, 0 },
+    { 1767401700, -84, { 137, 165, 1197, 756, 10121, 0, 96, 271, 0, 1237 }, false, 0, 0 },
+    { 1767402000, -534, { 167, 181, 1210, 737, 10122, 0, 127, 290, 0, 1250 }, false, 0, 0 },
+    { 1767402300, -57, { 160, 180, 1208, 732, 10121, 0, 83, 267, 0, 1248 }, false, 0, 0 },
+    { 1767402600, -550, { 154, 160, 1207, 745, 10123, 0, 90, 258, 0, 1247 }, false, 0, 0 },
+    { 1767402900, -23, { 128, 170, 1209, 717, 10124, 0, 74, 246, 0, 1249 }, false, 0, 0 },
+    { 1767403200, -414, { 189, 162, 1211, 730, 10124, 0, 126, 241, 0, 1251 }, false, 0, 0 },
+    { 1767403500, -268, { 176, 158, 1208, 729, 10124, 0, 90, 268, 0, 1248 }, false, 0, 0 },
+    { 1767403800, -210, { 154, 196, 1208, 735, 10126, 0, 107, 276, 0, 1248 }, false, 0, 0 },
+    { 1767404100, -481, { 169, 169, 1207, 722, 10126, 0, 128, 249, 0, 1247 }, false, 0, 0 },
+    { 1767404400, -254, { 209, 158, 1212, 724, 10130, 0, 142, 258, 0, 1252 }, false, 0, 0 },
+    { 1767404700, -462, { 196, 178, 1211, 721, 10129, 0, 100, 258, 0, 1251 }, false, 0, 0 },
+    { 1767405000, -408, { 168, 174, 1208, 735, 10129, 0, 112, 267, 0, 1248 }, false, 0, 0 },
+    { 1767405300, -243, { 170, 161, 1211, 700, 10131, 0, 95, 240, 0, 1251 }, false, 0, 0 },
+    { 1767405600, -353, { 224, 162, 1221, 705, 10129, 0, 122, 261, 0, 1261 }, false, 0, 0 },
+    { 1767405900, -136, { 210, 188, 1224, 682, 10132, 0, 131, 260, 0, 1264 }, false, 0, 0 },
+    { 1767406200, -195, { 171, 191, 1223, 698, 10132, 0, 118, 290, 0, 1263 }, false, 0, 0 },
+    { 1767406500, -515, { 154, 157, 1221, 701, 10133, 0, 102, 248, 0, 1261 }, false, 0, 0 },
+    { 1767406800, -472, { 178, 184, 1221, 703, 10132, 0, 137, 282, 0, 1261 }, false, 0, 0 },
+    { 1767407100, -305, { 280, 190, 1221, 690, 10132, 0, 151, 288, 0, 1261 }, false, 0, 0 },
+    { 1767407400, -441, { 122, 156, 1219, 713, 10131, 0, 85, 253, 0, 1259 }, false, 0, 0 },
+    { 1767407700, -53, { 201, 197, 1222, 706, 10133, 0, 110, 279, 0, 1262 }, false, 0, 0 },
+    { 1767408000, -37, { 139, 181, 1219, 694, 10136, 0, 99, 269, 0, 1259 }, false, 0, 0 },
+    { 1767408300, -529, { 200, 150, 1222, 689, 10135, 0, 128, 260, 0, 1262 }, false, 0, 0 },
+    { 1767408600, -110, { 99, 224, 1220, 687, 10134, 0, 67, 314, 0, 1260 }, false, 0, 0 },
+    { 1767408900, -363, { 96, 161, 1221, 703, 10135, 0, 66, 261, 0, 1261 }, false, 0, 0 },
+    { 1767409200, -399, { 109, 204, 1232, 674, 10132, 0, 54, 280, 0, 1272 }, false, 0, 0 },
+    { 1767409500, -1, { 87, 160, 1230, 674, 10131, 0, 53, 258, 0, 1270 }, false, 0, 0 },
+    { 1767409800, -409, { 191, 207, 1232, 672, 10133, 0, 97, 296, 0, 1272 }, false, 0, 0 },
+    { 1767410100, -437, { 138, 218, 1232, 670, 10135, 0, 97, 291, 0, 1272 }, false, 0, 0 },
+    { 1767410400, -137, { 18, 142, 1231, 665, 10137, 0, 2, 252, 0, 1271 }, false, 0, 0 },
+    { 1767410700, -190, { 63, 192, 1230, 681, 10136, 0, 34, 263, 0, 1270 }, false, 0, 0 },
+    { 1767411000, -121, { 71, 196, 1231, 669, 10135, 0, 36, 271, 0, 1271 }, false, 0, 0 },
+    { 1767411300, -448, { 64, 183, 1232, 660, 10136, 0, 42, 285, 0, 1272 }, false, 0, 0 },
+    { 1767411600, -83, { 120, 212, 1231, 661, 10136, 0, 65, 295, 0, 1271 }, false, 0, 0 },
+    { 1767411900, -519, { 79, 175, 1227, 669, 10138, 0, 30, 259, 0, 1267 }, false, 0, 0 },
+    { 1767412200, -283, { 69, 164, 1232, 662, 10140, 0, 49, 274, 0, 1272 }, false, 0, 0 },
+    { 1767412500, -92, { 100, 205, 1232, 674, 10136, 0, 38, 305, 0, 1272 }, false, 0, 0 },
+    { 1767412800, -570, { 84, 215, 1241, 651, 10136, 0, 68, 311, 0, 1281 }, false, 0, 0 },
+    { 1767413100, -231, { 89, 218, 1239, 652, 10135, 0, 19, 289, 0, 1279 }, false, 0, 0 },
+    { 1767413400, -450, { 44, 185, 1240, 638, 10135, 0, 18, 268, 0, 1280 }, false, 0, 0 },
+    { 1767413700, -286, { 104, 206, 1238, 639, 10134, 0, 41, 309, 0, 1278 }, false, 0, 0 },
+    { 1767414000, -117, { 81, 212, 1233, 666, 10133, 0, 58, 290, 0, 1273 }, false, 0, 0 },
+    { 1767414300, -270, { 142, 184, 1233, 679, 10134, 0, 32, 290, 0, 1273 }, false, 0, 0 },
+    { 1767414600, -83, { 116, 215, 1239, 660, 10135, 0, 73, 293, 0, 1279 }, false, 0, 0 },
+    { 1767414900, -96, { 74, 180, 1236, 661, 10135, 0, 29, 274, 0, 1276 }, false, 0, 0 },
+    { 1767415200, -348, { 81, 172, 1241, 641, 10136, 0, 47, 277, 0, 1281 }, false, 0, 0 },
+    { 1767415500, -394, { 81, 157, 1237, 669, 10136, 0, 46, 267, 0, 1277 }, false, 0, 0 },
+    { 1767415800, -197, { 186, 214, 1235, 676, 10136, 0, 74, 284, 0, 1275 }, false, 0, 0 },
+    { 1767416100, -62, { 56, 195, 1238, 660, 10136, 0, 38, 266, 0, 1278 }, false, 0, 0 },
+    { 1767416400, -326, { 116, 217, 1235, 645, 10136, 0, 54, 302, 0, 1275 }, false, 0, 0 },
+    { 1767416700, -290, { 97, 206, 1239, 646, 10138, 0, 56, 294, 0, 1279 }, false, 0, 0 },
+    { 1767417000, -538, { 160, 219, 1238, 653, 10140, 0, 67, 307, 0, 1278 }, false, 0, 0 },
+    { 1767417300, -155, { 65, 205, 1234, 655, 10139, 0, 43, 301, 0, 1274 }, false, 0, 0 },
+    { 1767417600, -374, { 185, 206, 1240, 638, 10139, 0, 73, 297, 0, 1280 }, false, 0, 0 },
+    { 1767417900, -371, { 161, 195, 1239, 651, 10139, 0, 118, 277, 0, 1279 }, false, 0, 0 },
+    { 1767418200, -500, { 215, 189, 1239, 668, 10136, 0, 148, 278, 0, 1279 }, false, 0, 0 },
+    { 1767418500, -74, { 128, 214, 1238, 659, 10136, 0, 91, 305, 0, 1278 }, false, 0, 0 },
+    { 1767418800, -567, { 209, 225, 1240, 649, 10138, 0, 138, 298, 0, 1280 }, false, 0, 0 },
+    { 1767419100, -508, { 224, 223, 1237, 653, 10139, 0, 115, 305, 0, 1277 }, false, 0, 0 },
+    { 1767419400, -537, { 197, 191, 1240, 657, 10141, 0, 129, 299, 0, 1280 }, false, 0, 0 },
+    { 1767419700, -260, { 174, 186, 1241, 646, 10143, 0, 122, 289, 0, 1281 }, false, 0, 0 },
+    { 1767420000, -356, { 163, 244, 1236, 652, 10140, 0, 120, 318, 0, 1276 }, false, 0, 0 },
+    { 1767420300, -378, { 220, 234, 1238, 676, 10138, 0, 129, 306, 0, 1278 }, false, 0, 0 },
+    { 1767420600, -516, { 172, 208, 1237, 679, 10137, 0, 59, 295, 0, 1277 }, false, 0, 0 },
+    { 1767420900, -332, { 154, 206, 1237, 646, 10135, 0, 89, 303, 0, 1277 }, false, 0, 0 },
+    { 1767421200, -427, { 168, 213, 1237, 661, 10138, 0, 101, 299, 0, 1277 }, false, 0, 0 },
+    { 1767421500, -383, { 219, 219, 1240, 632, 10136, 0, 127, 325, 0, 1280 }, false, 0, 0 },
+    { 1767421800, -193, { 182, 184, 1236, 671, 10139, 0, 140, 293, 0, 1276 }, false, 0, 0 },
+    { 1767422100, -26, { 196, 228, 1233, 670, 10139, 0, 111, 333, 0, 1273 }, false, 0, 0 },
+    { 1767422400, -242, { 200, 243, 1237, 675, 10140, 0, 151, 325, 0, 1277 }, false, 0, 0 },
+    { 1767422700, -390, { 216, 213, 1238, 653, 10141, 0, 137, 300, 0, 1278 }, false, 0, 0 },
+    { 1767423000, -367, { 171, 202, 1240, 665, 10138, 0, 123, 311, 0, 1280 }, false, 0, 0 },
+    { 1767423300, -565, { 241, 233, 1238, 642, 10139, 0, 160, 341, 0, 1278 }, false, 0, 0 },
+    { 1767423600, -96, { 257, 197, 1229, 672, 10140, 0, 186, 288, 0, 1269 }, false, 0, 0 },
+    { 1767423900, -215, { 246, 212, 1230, 661, 10140, 24, 178, 302, 2, 1270 }, true, 98, -93 },
+    { 1767424200, -448, { 294, 235, 1232, 664, 10138, 72, 197, 327, 8, 1272 }, true, 212, -365 },
+    { 1767424500, -189, { 232, 201, 1233, 680, 10138, 72, 154, 309, 14, 1273 }, true, 185, -504 },
+    { 1767424800, -525, { 353, 191, 1226, 679, 10142, 24, 204, 297, 16, 1266 }, true, 107, -402 },
+    { 1767425100, -383, { 237, 235, 1229, 677, 10141, 144, 138, 306, 28, 1269 }, true, 393, -8 },
+    { 1767425400, -210, { 277, 209, 1231, 655, 10142, 24, 195, 290, 30, 1271 }, true, 62, -277 },
+    { 1767425700, -54, { 210, 225, 1234, 678, 10143, 120, 156, 309, 40, 1274 }, true, 310, -53 },
+    { 1767426000, -165, { 273, 208, 1231, 668, 10144, 0, 174, 305, 40, 1271 }, false, 0, 0 },
+    { 1767426300, -347, { 235, 256, 1233, 683, 10145, 0, 159, 326, 40, 1273 }, false, 0, 0 },
+    { 1767426600, -106, { 200, 222, 1230, 682, 10149, 0, 142, 320, 40, 1270 }, false, 0, 0 },
+    { 1767426900, -2, { 246, 231, 1230, 680, 10150, 0, 156, 323, 40, 1270 }, false, 0, 0 },
+    { 1767427200, -275, { 286, 236, 1220, 703, 10149, 0, 162, 338, 40, 1260 }, false, 0, 0 },
+    { 1767427500, -172, { 240, 233, 1222, 690, 10149, 0, 154, 314, 40, 1262 }, false, 0, 0 },
+    { 1767427800, -240, { 265, 249, 1220, 707, 10151, 0, 196, 321, 40, 1260 }, false, 0, 0 },
+    { 1767428100, -169, { 280, 231, 1221, 687, 10149, 0, 194, 322, 40, 1261 }, false, 0, 0 },
+    { 1767428400, -369, { 407, 240, 1225, 695, 10151, 0, 237, 335, 40, 1265 }, false, 0, 0 },
+    { 1767428700, -6, { 277, 265, 1224, 690, 10153, 0, 207, 340, 40, 1264 }, false, 0, 0 },
+    { 1767429000, -512, { 296, 231, 1223, 670, 10152, 0, 220, 309, 40, 1263 }, false, 0, 0 },
+    { 1767429300, -331, { 354, 265, 1220, 716, 10151, 0, 241, 343, 40, 1260 }, false, 0, 0 },
+    { 1767429600, -395, { 396, 245, 1218, 694, 10150, 0, 268, 332, 40, 1258 }, false, 0, 0 },
+    { 1767429900, -567, { 391, 215, 1222, 706, 10151, 0, 304, 309, 40, 1262 }, false, 0, 0 },
+    { 1767430200, -486, { 382, 233, 1221, 687, 10151, 0, 282, 321, 40, 1261 }, false, 0, 0 },
+    { 1767430500, -350, { 348, 248, 1221, 692, 10156, 0, 258, 322, 40, 1261 }, false, 0, 0 },
+    { 1767430800, -170, { 391, 219, 1207, 750, 10159, 0, 260, 326, 40, 1247 }, false, 0, 0 },
+    { 1767431100, -72, { 415, 241, 1212, 713, 10159, 0, 316, 311, 40, 1252 }, false, 0, 0 },
+    { 1767431400, -269, { 448, 213, 1212, 712, 10161, 0, 343, 310, 40, 1252 }, false, 0, 0 },
+    { 1767431700, -288, { 443, 227, 1211, 726, 10162, 0, 307, 301, 40, 1251 }, false, 0, 0 },
+    { 1767432000, -199, { 445, 221, 1206, 745, 10161, 0, 315, 321, 40, 1246 }, false, 0, 0 },
+    { 1767432300, -160, { 438, 245, 1211, 723, 10161, 0, 322, 321, 40, 1251 }, false, 0, 0 },
+    { 1767432600, -159, { 524, 295, 1206, 739, 10160, 0, 356, 367, 40, 1246 }, false, 0, 0 },
+    { 1767432900, -29, { 446, 270, 1209, 739, 10160, 0, 308, 367, 40, 1249 }, false, 0, 0 },
+    { 1767433200, -197, { 472, 248, 1210, 739, 10158, 0, 346, 322, 40, 1250 }, false, 0, 0 },
+    { 1767433500, -511, { 473, 233, 1210, 723, 10157, 0, 350, 342, 40, 1250 }, false, 0, 0 },
+    { 1767433800, -146, { 473, 218, 1213, 716, 10156, 0, 341, 321, 40, 1253 }, false, 0, 0 },
+    { 1767434100, -516, { 542, 249, 1214, 702, 10159, 0, 337, 331, 40, 1254 }, false, 0, 0 },
+    { 1767434400, -152, { 465, 234, 1196, 759, 10161, 0, 352, 344, 40, 1236 }, false, 0, 0 },
+    { 1767434700, -23, { 487, 264, 1193, 766, 10161, 0, 338, 359, 40, 1233 }, false, 0, 0 },
+    { 1767435000, -439, { 498, 260, 1196, 753, 10157, 0, 329, 357, 40, 1236 }, false, 0, 0 },
+    { 1767435300, -405, { 510, 203, 1195, 767, 10155, 0, 354, 307, 40, 1235 }, false, 0, 0 },
+    { 1767435600, -545, { 441, 237, 1191, 766, 10157, 0, 330, 318, 40, 1231 }, false, 0, 0 },
+    { 1767435900, -304, { 485, 227, 1199, 767, 10159, 0, 346, 307, 40, 1239 }, false, 0, 0 },
+    { 1767436200, -101, { 452, 229, 1198, 761, 10159, 0, 347, 323, 40, 1238 }, false, 0, 0 },
+    { 1767436500, -538, { 424, 242, 1196, 758, 10159, 0, 313, 314, 40, 1236 }, false, 0, 0 },
+    { 1767436800, -10, { 464, 228, 1194, 771, 10160, 0, 352, 334, 40, 1234 }, false, 0, 0 },
+    { 1767437100, -27, { 488, 248, 1197, 753, 10163, 0, 328, 326, 40, 1237 }, false, 0, 0 },
+    { 1767437400, -209, { 484, 253, 1195, 753, 10162, 0, 321, 336, 40, 1235 }, false, 0, 0 },
+    { 1767437700, -414, { 464, 235, 1194, 755, 10165, 0, 354, 311, 40, 1234 }, false, 0, 0 },
+    { 1767438000, -105, { 485, 248, 1179, 777, 10166, 0, 346, 348, 40, 1219 }, false, 0, 0 },
+    { 1767438300, -257, { 465, 256, 1177, 782, 10164, 0, 353, 344, 40, 1217 }, false, 0, 0 },
+    { 1767438600, -160, { 401, 219, 1181, 803, 10164, 0, 280, 313, 40, 1221 }, false, 0, 0 },
+    { 1767438900, -464, { 373, 265, 1180, 794, 10164, 0, 253, 340, 40, 1220 }, false, 0, 0 },
+    { 1767439200, -12, { 401, 251, 1177, 800, 10166, 0, 259, 341, 40, 1217 }, false, 0, 0 },
+    { 1767439500, -428, { 446, 256, 1180, 786, 10165, 0, 311, 356, 40, 1220 }, false, 0, 0 },
+    { 1767439800, -513, { 440, 240, 1177, 812, 10165, 0, 310, 320, 40, 1217 }, false, 0, 0 },
+    { 1767440100, -21, { 360, 210, 1180, 817, 10168, 0, 268, 314, 40, 1220 }, false, 0, 0 },
+    { 1767440400, -504, { 384, 219, 1179, 799, 10168, 0, 248, 313, 40, 1219 }, false, 0, 0 },
+    { 1767440700, -157, { 411, 245, 1179, 782, 10170, 0, 273, 351, 40, 1219 }, false, 0, 0 },
+    { 1767441000, -226, { 386, 234, 1176, 791, 10169, 0, 269, 322, 40, 1216 }, false, 0, 0 },
+    { 1767441300, -340, { 464, 247, 1176, 809, 10173, 0, 269, 319, 40, 1216 }, false, 0, 0 },
+    { 1767441600, -299, { 379, 215, 1167, 823, 10174, 0, 282, 304, 40, 1207 }, false, 0, 0 },
+    { 1767441900, -442, { 436, 247, 1163, 844, 10172, 0, 280, 338, 40, 1203 }, false, 0, 0 },
+    { 1767442200, -223, { 450, 221, 1164, 818, 10170, 0, 265, 321, 40, 1204 }, false, 0, 0 },
+    { 1767442500, -112, { 309, 235, 1163, 839, 10172, 0, 206, 316, 40, 1203 }, false, 0, 0 },
+    { 1767442800, -4, { 333, 247, 1167, 824, 10173, 0, 229, 328, 40, 1207 }, false, 0, 0 },
+    { 1767443100, -294, { 257, 213, 1162, 851, 10175, 0, 175, 320, 40, 1202 }, false, 0, 0 },
+    { 1767443400, -554, { 267, 223, 1161, 845, 10174, 0, 182, 314, 40, 1201 }, false, 0, 0 },
+    { 1767443700, -265, { 243, 243, 1163, 853, 10172, 0, 180, 349, 40, 1203 }, false, 0, 0 },
+    { 1767444000, -221, { 318, 205, 1162, 834, 10174, 0, 222, 290, 40, 1202 }, false, 0, 0 },
+    { 1767444300, -570, { 299, 205, 1163, 825, 10175, 0, 212, 301, 40, 1203 }, false, 0, 0 },
+    { 1767444600, -201, { 379, 230, 1166, 846, 10175, 0, 251, 334, 40, 1206 }, false, 0, 0 },
+    { 1767444900, -417, { 313, 254, 1163, 843, 10172, 0, 233, 331, 40, 1203 }, false, 0, 0 },
+    { 1767445200, -60, { 383, 233, 1148, 880, 10173, 0, 268, 306, 40, 1188 }, false, 0, 0 },
+    { 1767445500, -341, { 443, 247, 1146, 873, 10172, 0, 265, 325, 40, 1186 }, false, 0, 0 },
+    { 1767445800, -174, { 383, 214, 1149, 867, 10175, 0, 294, 307, 40, 1189 }, false, 0, 0 },
+    { 1767446100, -588, { 432, 224, 1154, 872, 10173, 0, 302, 316, 40, 1194 }, false, 0, 0 },
+    { 1767446400, -240, { 478, 249, 1149, 862, 10174, 0, 316, 325, 40, 1189 }, false, 0, 0 },
+    { 1767446700, -61, { 364, 219, 1153, 859, 10173, 0, 255, 328, 40, 1193 }, false, 0, 0 },
+    { 1767447000, -378, { 446, 225, 1150, 887, 10171, 0, 328, 329, 40, 1190 }, false, 0, 0 },
+    { 1767447300, -12, { 388, 218, 1151, 870, 10171, 0, 282, 307, 40, 1191 }, false, 0, 0 },
+    { 1767447600, -246, { 436, 217, 1150, 868, 10170, 0, 331, 323, 40, 1190 }, false, 0, 0 },
+    { 1767447900, -214, { 491, 238, 1151, 860, 10172, 0, 326, 322, 40, 1191 }, false, 0, 0 },
+    { 1767448200, -583, { 460, 212, 1148, 896, 10172, 0, 345, 318, 40, 1188 }, false, 0, 0 },
+    { 1767448500, -413, { 584, 225, 1150, 852, 10174, 48, 376, 326, 44, 1190 }, true, 157, -372 },
+    { 1767448800, -546, { 521, 205, 1138, 910, 10174, 120, 381, 309, 54, 1178 }, true, 360, -316 },
+    { 1767449100, -201, { 505, 217, 1135, 917, 10175, 96, 375, 325, 62, 1175 }, true, 265, -352 },
+    { 1767449400, -15, { 467, 198, 1139, 903, 10172, 0, 320, 299, 62, 1179 }, false, 0, 0 },
+    { 1767449700, -437, { 497, 234, 1138, 909, 10170, 120, 355, 325, 72, 1178 }, true, 326, -263 },
+    { 1767450000, -415, { 569, 233, 1138, 890, 10170, 48, 394, 323, 76, 1178 }, true, 168, -419 },
+    { 1767450300, -512, { 545, 253, 1137, 914, 10173, 48, 377, 336, 80, 1177 }, true, 122, -376 },
+    { 1767450600, -597, { 565, 220, 1137, 897, 10173, 144, 416, 312, 92, 1177 }, true, 391, -573 },
+    { 1767450900, -481, { 551, 225, 1138, 914, 10174, 120, 421, 295, 102, 1178 }, true, 328, -553 },
+    { 1767451200, -316, { 568, 245, 1135, 920, 10175, 72, 371, 329, 108, 1175 }, true, 197, -81 },
+    { 1767451500, -510, { 530, 216, 1135, 900, 10174, 0, 370, 305, 108, 1175 }, false, 0, 0 },
+    { 1767451800, -379, { 575, 215, 1136, 925, 10175, 24, 410, 297, 110, 1176 }, true, 87, -337 },
+    { 1767452100, -299, { 529, 222, 1139, 899, 10173, 96, 398, 295, 118, 1179 }, true, 281, -587 },
+    { 1767452400, -538, { 545, 284, 1126, 935, 10170, 24, 421, 356, 120, 1166 }, true, 70, -439 },
+    { 1767452700, -222, { 561, 229, 1129, 919, 10170, 24, 417, 330, 122, 1169 }, true, 78, -76 },
+    { 1767453000, -57, { 565, 200, 1127, 927, 10170, 72, 441, 303, 128, 1167 }, true, 218, -53 },
+    { 1767453300, -427, { 508, 236, 1129, 931, 10171, 96, 376, 317, 136, 1169 }, true, 277, -576 },
+    { 1767453600, -545, { 478, 211, 1133, 911, 10171, 120, 354, 312, 146, 1173 }, true, 337, -9 },
+    { 1767453900, -188, { 562, 174, 1125, 937, 10171, 48, 409, 271, 150, 1165 }, true, 163, -176 },
+    { 1767454200, -252, { 473, 227, 1123, 931, 10172, 48, 351, 312, 154, 1163 }, true, 149, -271 },
+    { 1767454500, -379, { 484, 208, 1128, 930, 10171, 96, 370, 296, 162, 1168 }, true, 255, -216 },
+    { 1767454800, -79, { 526, 199, 1131, 927, 10171, 0, 398, 296, 162, 1171 }, false, 0, 0 },
+    { 1767455100, -8, { 470, 204, 1129, 913, 10170, 72, 350, 298, 168, 1169 }, true, 227, -79 },
+    { 1767455400, -189, { 573, 205, 1129, 907, 10171, 72, 391, 296, 174, 1169 }, true, 220, -200 },
+    { 1767455700, -262, { 523, 202, 1128, 926, 10170, 72, 399, 311, 180, 1168 }, true, 218, -214 },
+    { 1767456000, -269, { 586, 190, 1124, 930, 10172, 120, 441, 279, 190, 1164 }, true, 302, -394 },
+    { 1767456300, -455, { 568, 201, 1121, 957, 10174, 144, 427, 302, 202, 1161 }, true, 409, -78 },
+    { 1767456600, -64, { 560, 200, 1121, 962, 10175, 48, 410, 296, 206, 1161 }, true, 132, -96 },
+    { 1767456900, -233, { 613, 190, 1125, 932, 10177, 48, 420, 296, 210, 1165 }, true, 149, -224 },
+    { 1767457200, -587, { 567, 219, 1123, 931, 10176, 48, 423, 310, 214, 1163 }, true, 143, -201 },
+    { 1767457500, -591, { 599, 185, 1121, 957, 10175, 120, 429, 283, 224, 1161 }, true, 313, -333 },
+    { 1767457800, -131, { 599, 217, 1124, 939, 10175, 96, 442, 307, 232, 1164 }, true, 260, -395 },
+    { 1767458100, -51, { 598, 189, 1119, 934, 10175, 96, 432, 280, 240, 1159 }, true, 269, -517 },
+    { 1767458400, -33, { 620, 217, 1120, 940, 10177, 0, 425, 302, 240, 1160 }, false, 0, 0 },
+    { 1767458700, -393, { 585, 211, 1119, 949, 10174, 72, 407, 294, 246, 1159 }, true, 184, -511 },
+    { 1767459000, -184, { 542, 184, 1120, 963, 10175, 24, 413, 270, 248, 1160 }, true, 104, -597 },
+    { 1767459300, -73, { 602, 190, 1120, 958, 10177, 144, 452, 295, 260, 1160 }, true, 372, -576 },
+    { 1767459600, -326, { 581, 190, 1121, 952, 10174, 0, 413, 289, 260, 1161 }, false, 0, 0 },
+    { 1767459900, -115, { 563, 189, 1120, 964, 10173, 72, 375, 298, 266, 1160 }, true, 186, -259 },
+    { 1767460200, -29, { 583, 195, 1121, 942, 10170, 120, 403, 279, 276, 1161 }, true, 349, -75 },
+    { 1767460500, -406, { 552, 194, 1121, 933, 10169, 72, 408, 298, 282, 1161 }, true, 186, -373 },
+    { 1767460800, -220, { 650, 193, 1119, 936, 10170, 120, 433, 294, 292, 1159 }, true, 351, -211 },
+    { 1767461100, -91, { 553, 203, 1122, 925, 10172, 48, 412, 300, 296, 1162 }, true, 169, -561 },
+    { 1767461400, -426, { 567, 194, 1119, 963, 10174, 96, 412, 284, 304, 1159 }, true, 294, -592 },
+    { 1767461700, -140, { 580, 204, 1118, 945, 10173, 96, 408, 289, 312, 1158 }, true, 285, -288 },
+    { 1767462000, -592, { 607, 211, 1118, 956, 10176, 72, 463, 292, 318, 1158 }, true, 220, -516 },
+    { 1767462300, -368, { 570, 189, 1119, 947, 10177, 0, 437, 296, 318, 1159 }, false, 0, 0 },
+    { 1767462600, -230, { 641, 173, 1119, 954, 10178, 0, 439, 270, 318, 1159 }, false, 0, 0 },
+    { 1767462900, -540, { 637, 201, 1119, 927, 10182, 0, 457, 284, 318, 1159 }, false, 0, 0 },
+    { 1767463200, -468, { 562, 218, 1124, 925, 10182, 0, 419, 293, 318, 1164 }, false, 0, 0 },
+    { 1767463500, -99, { 595, 170, 1120, 969, 10183, 0, 431, 275, 318, 1160 }, false, 0, 0 },
+    { 1767463800, -400, { 508, 221, 1120, 948, 10182, 0, 385, 294, 318, 1160 }, false, 0, 0 },
+    { 1767464100, -376, { 484, 211, 1123, 939, 10182, 0, 365, 287, 318, 1163 }, false, 0, 0 },
+    { 1767464400, -377, { 558, 172, 1122, 942, 10183, 0, 380, 278, 318, 1162 }, false, 0, 0 },
+    { 1767464700, -455, { 504, 208, 1120, 933, 10183, 0, 364, 295, 318, 1160 }, false, 0, 0 },
+    { 1767465000, -205, { 567, 199, 1118, 969, 10183, 0, 421, 301, 318, 1158 }, false, 0, 0 },
+    { 1767465300, -136, { 481, 163, 1121, 946, 10183, 0, 365, 268, 318, 1161 }, false, 0, 0 },
+    { 1767465600, -592, { 486, 224, 1123, 941, 10181, 0, 338, 306, 318, 1163 }, false, 0, 0 },
+    { 1767465900, -17, { 500, 220, 1124, 924, 10183, 0, 337, 293, 318, 1164 }, false, 0, 0 },
+    { 1767466200, -563, { 485, 191, 1121, 930, 10184, 0, 334, 290, 318, 1161 }, false, 0, 0 },
+    { 1767466500, -123, { 509, 210, 1123, 940, 10182, 0, 386, 280, 318, 1163 }, false, 0, 0 },
+    { 1767466800, -239, { 499, 170, 1129, 938, 10180, 0, 363, 270, 318, 1169 }, false, 0, 0 },
+    { 1767467100, -475, { 479, 208, 1126, 933, 10181, 0, 356, 283, 318, 1166 }, false, 0, 0 },
+    { 1767467400, -382, { 477, 180, 1127, 915, 10181, 0, 347, 261, 318, 1167 }, false, 0, 0 },
+    { 1767467700, -560, { 485, 198, 1127, 928, 10181, 0, 364, 293, 318, 1167 }, false, 0, 0 },
+    { 1767468000, -494, { 485, 165, 1124, 941, 10180, 0, 356, 256, 318, 1164 }, false, 0, 0 },
+    { 1767468300, -326, { 507, 203, 1123, 912, 10179, 0, 384, 277, 318, 1163 }, false, 0, 0 },
+    { 1767468600, -381, { 466, 220, 1131, 925, 10178, 0, 325, 295, 318, 1171 }, false, 0, 0 },
+    { 1767468900, -221, { 436, 171, 1127, 934, 10177, 0, 312, 267, 318, 1167 }, false, 0, 0 },
+    { 1767469200, -169, { 518, 198, 1128, 915, 10176, 0, 363, 268, 318, 1168 }, false, 0, 0 },
+    { 1767469500, -29, { 475, 194, 1128, 931, 10175, 0, 348, 284, 318, 1168 }, false, 0, 0 },
+    { 1767469800, -100, { 490, 166, 1127, 926, 10176, 0, 366, 275, 318, 1167 }, false, 0, 0 },
+    { 1767470100, -449, { 589, 208, 1127, 935, 10175, 0, 367, 278, 318, 1167 }, false, 0, 0 },
+    { 1767470400, -65, { 487, 176, 1133, 897, 10175, 0, 358, 257, 318, 1173 }, false, 0, 0 },
+    { 1767470700, -391, { 524, 159, 1133, 913, 10174, 0, 379, 262, 318, 1173 }, false, 0, 0 },
+    { 1767471000, -389, { 518, 176, 1136, 903, 10176, 0, 363, 263, 318, 1176 }, false, 0, 0 },
+    { 1767471300, -222, { 504, 162, 1137, 902, 10176, 0, 387, 259, 318, 1177 }, false, 0, 0 },
+    { 1767471600, -177, { 513, 191, 1138, 905, 10175, 0, 387, 298, 318, 1178 }, false, 0, 0 },
+    { 1767471900, -214, { 474, 180, 1137, 924, 10177, 0, 354, 256, 318, 1177 }, false, 0, 0 },
+    { 1767472200, -237, { 523, 169, 1136, 934, 10174, 0, 377, 265, 318, 1176 }, false, 0, 0 },
+    { 1767472500, -328, { 445, 164, 1140, 893, 10174, 0, 333, 266, 318, 1180 }, false, 0, 0 },
+    { 1767472800, -229, { 492, 163, 1138, 902, 10171, 0, 345, 239, 318, 1178 }, false, 0, 0 },
+    { 1767473100, -387, { 493, 163, 1136, 905, 10171, 0, 362, 236, 318, 1176 }, false, 0, 0 },
+    { 1767473400, -118, { 416, 200, 1139, 887, 10169, 0, 296, 274, 318, 1179 }, false, 0, 0 },
+    { 1767473700, -147, { 449, 180, 1135, 909, 10169, 0, 334, 258, 318, 1175 }, false, 0, 0 },
+    { 1767474000, -168, { 545, 142, 1150, 859, 10171, 0, 333, 240, 318, 1190 }, false, 0, 0 },
+    { 1767474300, -135, { 438, 160, 1148, 872, 10170, 0, 334, 243, 318, 1188 }, false, 0, 0 },
+    { 1767474600, -483, { 444, 209, 1147, 895, 10170, 0, 338, 283, 318, 1187 }, false, 0, 0 },
+    { 1767474900, -556, { 454, 180, 1149, 874, 10171, 0, 279, 263, 318, 1189 }, false, 0, 0 },
+    { 1767475200, -168, { 459, 195, 1148, 887, 10171, 0, 338, 266, 318, 1188 }, false, 0, 0 },
+    { 1767475500, -403, { 470, 167, 1152, 865, 10171, 0, 329, 269, 318, 1192 }, false, 0, 0 },
+    { 1767475800, -455, { 459, 153, 1152, 886, 10175, 0, 340, 251, 318, 1192 }, false, 0, 0 },
+    { 1767476100, -146, { 472, 193, 1152, 875, 10174, 0, 344, 276, 318, 1192 }, false, 0, 0 },
+    { 1767476400, -592, { 504, 159, 1151, 870, 10176, 0, 348, 245, 318, 1191 }, false, 0, 0 },
+    { 1767476700, -144, { 512, 172, 1149, 891, 10177, 0, 357, 279, 318, 1189 }, false, 0, 0 },
+    { 1767477000, -498, { 527, 169, 1151, 873, 10178, 0, 343, 263, 318, 1191 }, false, 0, 0 },
+    { 1767477300, -234, { 499, 141, 1150, 877, 10179, 0, 348, 248, 318, 1190 }, false, 0, 0 },
+    { 1767477600, -67, { 517, 156, 1161, 853, 10181, 0, 347, 247, 318, 1201 }, false, 0, 0 },
+    { 1767477900, -47, { 539, 165, 1164, 854, 10181, 0, 370, 260, 318, 1204 }, false, 0, 0 },
+    { 1767478200, -364, { 474, 159, 1162, 856, 10181, 0, 348, 242, 318, 1202 }, false, 0, 0 },
+    { 1767478500, -377, { 432, 165, 1168, 829, 10180, 0, 324, 257, 318, 1208 }, false, 0, 0 },
+    { 1767478800, -600, { 453, 183, 1166, 832, 10181, 0, 315, 253, 318, 1206 }, false, 0, 0 },
+    { 1767479100, -76, { 481, 169, 1165, 844, 10180, 0, 324, 250, 318, 1205 }, false, 0, 0 },
+    { 1767479400, -152, { 419, 146, 1166, 831, 10180, 0, 281, 245, 318, 1206 }, false, 0, 0 },
+    { 1767479700, -244, { 425, 152, 1162, 830, 10180, 0, 314, 259, 318, 1202 }, false, 0, 0 },
+    { 1767480000, -81, { 441, 148, 1164, 850, 10179, 0, 305, 256, 318, 1204 }, false, 0, 0 },
+    { 1767480300, -575, { 460, 174, 1164, 844, 10178, 0, 305, 245, 318, 1204 }, false, 0, 0 },
+    { 1767480600, -206, { 375, 185, 1164, 848, 10178, 0, 275, 270, 318, 1204 }, false, 0, 0 },
+    { 1767480900, -30, { 413, 187, 1166, 835, 10175, 0, 288, 265, 318, 1206 }, false, 0, 0 },
+    { 1767481200, -342, { 381, 142, 1180, 813, 10174, 0, 269, 242, 0, 1220 }, false, 0, 0 },
+    { 1767481500, -119, { 357, 174, 1180, 796, 10171, 0, 253, 262, 0, 1220 }, false, 0, 0 },
+    { 1767481800, -580, { 371, 123, 1184, 779, 10169, 0, 253, 218, 0, 1224 }, false, 0, 0 },
+    { 1767482100, -317, { 435, 106, 1180, 794, 10171, 0, 248, 216, 0, 1220 }, false, 0, 0 },
+    { 1767482400, -148, { 351, 183, 1180, 789, 10170, 0, 258, 285, 0, 1220 }, false, 0, 0 },
+    { 1767482700, -225, { 348, 169, 1177, 817, 10166, 0, 262, 256, 0, 1217 }, false, 0, 0 },
+    { 1767483000, -353, { 353, 167, 1181, 804, 10164, 0, 273, 248, 0, 1221 }, false, 0, 0 },
+    { 1767483300, -492, { 356, 164, 1178, 815, 10159, 0, 250, 247, 0, 1218 }, false, 0, 0 },
+    { 1767483600, -32, { 332, 135, 1182, 796, 10158, 0, 251, 235, 0, 1222 }, false, 0, 0 },
+    { 1767483900, -176, { 346, 167, 1179, 785, 10158, 0, 268, 239, 0, 1219 }, false, 0, 0 },
+    { 1767484200, -457, { 346, 152, 1183, 797, 10158, 0, 261, 248, 0, 1223 }, false, 0, 0 },
+    { 1767484500, -324, { 454, 172, 1178, 800, 10157, 0, 282, 252, 0, 1218 }, false, 0, 0 },
+    { 1767484800, -216, { 352, 145, 1193, 762, 10156, 0, 268, 247, 0, 1233 }, false, 0, 0 },
+    { 1767485100, -454, { 419, 178, 1195, 758, 10156, 0, 253, 261, 0, 1235 }, false, 0, 0 },
+    { 1767485400, -194, { 390, 163, 1196, 777, 10152, 0, 270, 249, 0, 1236 }, false, 0, 0 },
+    { 1767485700, -303, { 385, 132, 1196, 770, 10157, 0, 266, 212, 0, 1236 }, false, 0, 0 },
+    { 1767486000, -182, { 372, 141, 1196, 761, 10157, 0, 263, 228, 0, 1236 }, false, 0, 0 },
+    { 1767486300, -532, { 313, 155, 1195, 775, 10156, 0, 239, 260, 0, 1235 }, false, 0, 0 },
+    { 1767486600, -495, { 348, 166, 1190, 771, 10156, 0, 237, 266, 0, 1230 }, false, 0, 0 },
+    { 1767486900, -455, { 364, 158, 1193, 744, 10156, 0, 243, 238, 0, 1233 }, false, 0, 0 },
+    { 1767487200, -78, { 334, 185, 1196, 763, 10158, 0, 242, 276, 0, 1236 }, false, 0, 0 },
+    { 1767487500, -141, { 338, 155, 1196, 756, 10156, 0, 245, 254, 0, 1236 }, false, 0, 0 },
+    { 1767487800, -452, { 330, 144, 1198, 748, 10155, 0, 256, 241, 0, 1238 }, false, 0, 0 },
+    { 1767488100, -365, { 386, 182, 1194, 779, 10155, 0, 243, 261, 0, 1234 }, false, 0, 0 },
+    { 1767488400, -306, { 299, 161, 1209, 708, 10159, 0, 203, 247, 0, 1249 }, false, 0, 0 },
+    { 1767488700, -537, { 331, 169, 1210, 718, 10159, 0, 196, 239, 0, 1250 }, false, 0, 0 },
+    { 1767489000, -284, { 305, 173, 1207, 728, 10158, 0, 218, 267, 0, 1247 }, false, 0, 0 },
+    { 1767489300, -539, { 252, 161, 1208, 713, 10158, 0, 173, 256, 0, 1248 }, false, 0, 0 },
+    { 1767489600, -390, { 275, 150, 1207, 735, 10158, 0, 200, 241, 0, 1247 }, false, 0, 0 },
+    { 1767489900, -16, { 310, 199, 1212, 734, 10159, 0, 185, 282, 0, 1252 }, false, 0, 0 },
+    { 1767490200, -234, { 341, 171, 1208, 726, 10158, 0, 191, 251, 0, 1248 }, false, 0, 0 },
+    { 1767490500, -338, { 247, 116, 1206, 742, 10157, 0, 163, 222, 0, 1246 }, false, 0, 0 },
+    { 1767490800, -11, { 302, 166, 1208, 732, 10157, 0, 224, 247, 0, 1248 }, false, 0, 0 },
+    { 1767491100, -39, { 315, 194, 1211, 710, 10159, 0, 227, 269, 0, 1251 }, false, 0, 0 },
+    { 1767491400, -255, { 310, 156, 1206, 729, 10157, 0, 230, 253, 0, 1246 }, false, 0, 0 },
+    { 1767491700, -215, { 333, 154, 1208, 716, 10154, 0, 211, 250, 0, 1248 }, false, 0, 0 },
+    { 1767492000, -125, { 288, 153, 1221, 690, 10153, 0, 190, 258, 0, 1261 }, false, 0, 0 },
+    { 1767492300, -600, { 279, 174, 1224, 690, 10151, 0, 214, 269, 0, 1264 }, false, 0, 0 },
+    { 1767492600, -307, { 324, 147, 1221, 688, 10148, 0, 232, 244, 0, 1261 }, false, 0, 0 },
+    { 1767492900, -269, { 316, 187, 1222, 691, 10149, 0, 218, 263, 0, 1262 }, false, 0, 0 },
+    { 1767493200, -69, { 334, 166, 1219, 711, 10149, 0, 227, 249, 0, 1259 }, false, 0, 0 },
+    { 1767493500, -583, { 359, 157, 1224, 681, 10148, 0, 263, 247, 0, 1264 }, false, 0, 0 },
+    { 1767493800, -233, { 309, 147, 1225, 700, 10147, 0, 231, 241, 0, 1265 }, false, 0, 0 },
+    { 1767494100, -199, { 325, 188, 1220, 680, 10148, 0, 240, 283, 0, 1260 }, false, 0, 0 },
+    { 1767494400, -154, { 340, 166, 1218, 719, 10147, 0, 261, 267, 0, 1258 }, false, 0, 0 },
+    { 1767494700, -212, { 395, 200, 1224, 700, 10147, 0, 271, 278, 0, 1264 }, false, 0, 0 },
+    { 1767495000, -469, { 382, 142, 1225, 670, 10148, 0, 299, 250, 0, 1265 }, false, 0, 0 },
+    { 1767495300, -265, { 407, 151, 1220, 701, 10148, 0, 301, 255, 0, 1260 }, false, 0, 0 },
+    { 1767495600, -297, { 439, 179, 1230, 679, 10145, 0, 289, 275, 0, 1270 }, false, 0, 0 },
+    { 1767495900, -488, { 461, 167, 1232, 665, 10143, 0, 317, 257, 0, 1272 }, false, 0, 0 },
+    { 1767496200, -315, { 448, 155, 1233, 672, 10144, 0, 345, 262, 0, 1273 }, false, 0, 0 },
+    { 1767496500, -533, { 485, 173, 1233, 659, 10143, 0, 321, 251, 0, 1273 }, false, 0, 0 },
+    { 1767496800, -526, { 492, 174, 1234, 652, 10141, 0, 314, 278, 0, 1274 }, false, 0, 0 },
+    { 1767497100, -389, { 431, 202, 1230, 668, 10140, 0, 310, 278, 0, 1270 }, false, 0, 0 },
+    { 1767497400, -376, { 458, 153, 1231, 674, 10137, 0, 349, 253, 0, 1271 }, false, 0, 0 },
+    { 1767497700, -581, { 383, 155, 1231, 655, 10135, 0, 288, 248, 0, 1271 }, false, 0, 0 },
+    { 1767498000, -179, { 383, 165, 1233, 660, 10135, 0, 283, 272, 0, 1273 }, false, 0, 0 },
+    { 1767498300, -79, { 386, 187, 1234, 661, 10132, 0, 247, 270, 0, 1274 }, false, 0, 0 },
+    { 1767498600, -11, { 385, 208, 1230, 682, 10130, 0, 244, 284, 0, 1270 }, false, 0, 0 },
+    { 1767498900, -269, { 384, 172, 1231, 684, 10130, 0, 271, 255, 0, 1271 }, false, 0, 0 },
+    { 1767499200, -82, { 319, 177, 1240, 639, 10129, 0, 220, 262, 0, 1280 }, false, 0, 0 },
+    { 1767499500, -126, { 405, 158, 1237, 650, 10130, 0, 284, 261, 0, 1277 }, false, 0, 0 },
+    { 1767499800, -274, { 379, 167, 1232, 681, 10129, 0, 274, 262, 0, 1272 }, false, 0, 0 },
+    { 1767500100, -466, { 389, 189, 1238, 653, 10129, 0, 281, 261, 0, 1278 }, false, 0, 0 },
+    { 1767500400, -170, { 367, 161, 1237, 662, 10129, 0, 239, 260, 0, 1277 }, false, 0, 0 },
+    { 1767500700, -348, { 346, 203, 1238, 664, 10128, 0, 251, 288, 0, 1278 }, false, 0, 0 },
+    { 1767501000, -146, { 425, 163, 1236, 663, 10130, 0, 294, 270, 0, 1276 }, false, 0, 0 },
+    { 1767501300, -183, { 394, 182, 1237, 654, 10130, 0, 275, 261, 0, 1277 }, false, 0, 0 },
+    { 1767501600, -6, { 362, 166, 1236, 647, 10131, 0, 247, 263, 0, 1276 }, false, 0, 0 },
+    { 1767501900, -452, { 353, 179, 1239, 665, 10129, 0, 249, 274, 0, 1279 }, false, 0, 0 },
+    { 1767502200, -412, { 339, 206, 1240, 651, 10131, 0, 249, 283, 0, 1280 }, false, 0, 0 },
+    { 1767502500, -452, { 423, 189, 1239, 660, 10132, 0, 283, 283, 0, 1279 }, false, 0, 0 },
+    { 1767502800, -269, { 355, 148, 1241, 638, 10133, 0, 249, 223, 0, 1281 }, false, 0, 0 },
+    { 1767503100, -361, { 325, 186, 1240, 654, 10131, 0, 247, 282, 0, 1280 }, false, 0, 0 },
+    { 1767503400, -146, { 321, 156, 1241, 638, 10130, 0, 240, 238, 0, 1281 }, false, 0, 0 },
+    { 1767503700, -369, { 294, 173, 1239, 631, 10131, 0, 212, 264, 0, 1279 }, false, 0, 0 },
+    { 1767504000, -270, { 403, 187, 1240, 645, 10132, 0, 268, 284, 0, 1280 }, false, 0, 0 },
+    { 1767504300, -186, { 329, 180, 1241, 642, 10131, 0, 243, 284, 0, 1281 }, false, 0, 0 },
+    { 1767504600, -194, { 341, 204, 1238, 656, 10130, 0, 253, 280, 0, 1278 }, false, 0, 0 },
+    { 1767504900, -586, { 408, 188, 1239, 637, 10131, 0, 263, 287, 0, 1279 }, false, 0, 0 },
+    { 1767505200, -392, { 321, 166, 1239, 637, 10131, 0, 248, 273, 0, 1279 }, false, 0, 0 },
+    { 1767505500, -236, { 307, 182, 1237, 674, 10134, 0, 209, 270, 0, 1277 }, false, 0, 0 },
+    { 1767505800, -448, { 337, 183, 1236, 656, 10134, 0, 245, 281, 0, 1276 }, false, 0, 0 },
+    { 1767506100, -444, { 302, 174, 1238, 649, 10137, 0, 234, 251, 0, 1278 }, false, 0, 0 },
+    { 1767506400, -37, { 267, 196, 1236, 656, 10136, 0, 180, 286, 0, 1276 }, false, 0, 0 },
+    { 1767506700, -7, { 329, 219, 1237, 645, 10135, 0, 242, 306, 0, 1277 }, false, 0, 0 },
+    { 1767507000, -420, { 278, 191, 1237, 650, 10133, 0, 206, 292, 0, 1277 }, false, 0, 0 },
+    { 1767507300, -127, { 334, 188, 1240, 641, 10133, 0, 232, 289, 0, 1280 }, false, 0, 0 },
+    { 1767507600, -570, { 354, 162, 1234, 662, 10134, 0, 246, 261, 0, 1274 }, false, 0, 0 },
+    { 1767507900, -550, { 322, 179, 1233, 674, 10134, 0, 237, 285, 0, 1273 }, false, 0, 0 },
+    { 1767508200, -161, { 303, 203, 1235, 653, 10132, 0, 190, 286, 0, 1275 }, false, 0, 0 },
+    { 1767508500, -168, { 291, 199, 1236, 668, 10134, 0, 216, 294, 0, 1276 }, false, 0, 0 },
+    { 1767508800, -39, { 272, 207, 1236, 659, 10134, 0, 199, 312, 0, 1276 }, false, 0, 0 },
+    { 1767509100, -443, { 302, 211, 1236, 651, 10133, 0, 230, 321, 0, 1276 }, false, 0, 0 },
+    { 1767509400, -409, { 288, 183, 1238, 658, 10134, 0, 194, 283, 0, 1278 }, false, 0, 0 },
+    { 1767509700, -316, { 265, 162, 1239, 648, 10135, 0, 176, 271, 0, 1279 }, false, 0, 0 },
+    { 1767510000, -51, { 314, 226, 1231, 671, 10137, 0, 224, 302, 0, 1271 }, false, 0, 0 },
+    { 1767510300, -367, { 296, 208, 1233, 663, 10133, 0, 207, 301, 0, 1273 }, false, 0, 0 },
+    { 1767510600, -49, { 252, 181, 1230, 655, 10131, 0, 174, 283, 0, 1270 }, false, 0, 0 },
+    { 1767510900, -70, { 279, 175, 1230, 666, 10130, 0, 169, 273, 0, 1270 }, false, 0, 0 },
+    { 1767511200, -271, { 321, 195, 1233, 665, 10131, 0, 224, 300, 0, 1273 }, false, 0, 0 },
+    { 1767511500, -167, { 318, 218, 1235, 667, 10133, 0, 237, 292, 0, 1275 }, false, 0, 0 },
+    { 1767511800, -508, { 326, 208, 1231, 677, 10133, 0, 230, 307, 0, 1271 }, false, 0, 0 },
+    { 1767512100, -527, { 265, 211, 1235, 661, 10135, 0, 193, 311, 0, 1275 }, false, 0, 0 },
+    { 1767512400, -74, { 306, 260, 1230, 670, 10136, 0, 199, 333, 0, 1270 }, false, 0, 0 },
+    { 1767512700, -114, { 256, 205, 1231, 674, 10136, 0, 188, 310, 0, 1271 }, false, 0, 0 },
+    { 1767513000, -481, { 347, 195, 1233, 670, 10136, 0, 212, 276, 0, 1273 }, false, 0, 0 },
+    { 1767513300, -357, { 247, 184, 1232, 673, 10135, 0, 177, 292, 0, 1272 }, false, 0, 0 },
+    { 1767513600, -358, { 291, 214, 1224, 696, 10134, 0, 212, 309, 0, 1264 }, false, 0, 0 },
+    { 1767513900, -73, { 275, 214, 1220, 708, 10131, 0, 166, 319, 0, 1260 }, false, 0, 0 },
+    { 1767514200, -90, { 284, 229, 1219, 712, 10130, 0, 163, 310, 0, 1259 }, false, 0, 0 },
+    { 1767514500, -403, { 228, 228, 1220, 703, 10129, 0, 171, 307, 0, 1260 }, false, 0, 0 },
+    { 1767514800, -248, { 250, 224, 1224, 693, 10127, 0, 178, 303, 0, 1264 }, false, 0, 0 },
+    { 1767515100, -61, { 327, 223, 1222, 718, 10128, 0, 206, 316, 0, 1262 }, false, 0, 0 },
+    { 1767515400, -558, { 285, 189, 1222, 689, 10128, 0, 188, 287, 0, 1262 }, false, 0, 0 },
+    { 1767515700, -304, { 232, 215, 1221, 681, 10128, 0, 162, 316, 0, 1261 }, false, 0, 0 },
+    { 1767516000, -240, { 236, 188, 1223, 686, 10128, 0, 172, 293, 0, 1263 }, false, 0, 0 },
+    { 1767516300, -587, { 202, 235, 1223, 699, 10130, 0, 140, 315, 0, 1263 }, false, 0, 0 },
+    { 1767516600, -131, { 169, 227, 1222, 686, 10131, 0, 110, 316, 0, 1262 }, false, 0, 0 },
+    { 1767516900, -283, { 243, 260, 1220, 690, 10128, 0, 135, 330, 0, 1260 }, false, 0, 0 },
+    { 1767517200, -569, { 230, 237, 1212, 735, 10129, 0, 150, 318, 0, 1252 }, false, 0, 0 },
+    { 1767517500, -4, { 211, 205, 1211, 713, 10132, 0, 157, 302, 0, 1251 }, false, 0, 0 },
+    { 1767517800, -131, { 174, 215, 1208, 741, 10131, 0, 132, 303, 0, 1248 }, false, 0, 0 },
+    { 1767518100, -327, { 192, 203, 1209, 747, 10132, 0, 103, 308, 0, 1249 }, false, 0, 0 },
+    { 1767518400, -592, { 186, 234, 1207, 726, 10131, 0, 95, 310, 0, 1247 }, false, 0, 0 },
+    { 1767518700, -25, { 206, 216, 1206, 736, 10133, 0, 130, 323, 0, 1246 }, false, 0, 0 },
+    { 1767519000, -591, { 234, 224, 1211, 724, 10134, 0, 160, 310, 0, 1251 }, false, 0, 0 },
+    { 1767519300, -130, { 217, 203, 1210, 728, 10135, 0, 152, 296, 0, 1250 }, false, 0, 0 },
+    { 1767519600, -217, { 191, 235, 1212, 726, 10136, 0, 120, 308, 0, 1252 }, false, 0, 0 },
+    { 1767519900, -450, { 175, 242, 1214, 706, 10137, 0, 107, 318, 0, 1254 }, false, 0, 0 },
+    { 1767520200, -35, { 204, 220, 1208, 731, 10138, 0, 127, 302, 0, 1248 }, false, 0, 0 },
+    { 1767520500, -555, { 255, 203, 1210, 742, 10139, 0, 152, 305, 0, 1250 }, false, 0, 0 },
+    { 1767520800, -473, { 175, 257, 1195, 774, 10141, 0, 137, 328, 0, 1235 }, false, 0, 0 },
+    { 1767521100, -260, { 218, 260, 1198, 743, 10144, 0, 163, 341, 0, 1238 }, false, 0, 0 },
+    { 1767521400, -271, { 227, 234, 1195, 764, 10143, 0, 179, 310, 0, 1235 }, false, 0, 0 },
+    { 1767521700, -547, { 193, 233, 1193, 775, 10141, 0, 132, 327, 0, 1233 }, false, 0, 0 },
+    { 1767522000, -8, { 256, 248, 1197, 762, 10144, 0, 155, 329, 0, 1237 }, false, 0, 0 },
+    { 1767522300, -84, { 207, 211, 1193, 761, 10144, 0, 155, 318, 0, 1233 }, false, 0, 0 },
+    { 1767522600, -72, { 215, 258, 1192, 771, 10144, 0, 155, 346, 0, 1232 }, false, 0, 0 },
+    { 1767522900, -223, { 256, 224, 1190, 772, 10147, 0, 154, 328, 0, 1230 }, false, 0, 0 },
+    { 1767523200, -212, { 300, 257, 1197, 765, 10146, 0, 168, 357, 0, 1237 }, false, 0, 0 },
+    { 1767523500, -113, { 305, 219, 1194, 769, 10148, 0, 151, 317, 0, 1234 }, false, 0, 0 },
+    { 1767523800, -50, { 259, 229, 1196, 766, 10147, 0, 168, 323, 0, 1236 }, false, 0, 0 },
+    { 1767524100, -466, { 222, 217, 1194, 776, 10149, 0, 97, 319, 0, 1234 }, false, 0, 0 },
+    { 1767524400, -56, { 189, 247, 1181, 797, 10149, 0, 124, 321, 0, 1221 }, false, 0, 0 },
+    { 1767524700, -564, { 208, 233, 1180, 792, 10147, 0, 151, 324, 0, 1220 }, false, 0, 0 },
+    { 1767525000, -427, { 228, 232, 1179, 816, 10148, 0, 150, 320, 0, 1219 }, false, 0, 0 },
+    { 1767525300, -330, { 224, 238, 1182, 786, 10149, 0, 110, 333, 0, 1222 }, false, 0, 0 },
+    { 1767525600, -357, { 159, 241, 1180, 792, 10149, 0, 91, 341, 0, 1220 }, false, 0, 0 },
+    { 1767525900, -345, { 169, 259, 1176, 793, 10147, 0, 128, 348, 0, 1216 }, false, 0, 0 },
+    { 1767526200, -140, { 168, 260, 1178, 801, 10145, 0, 108, 333, 0, 1218 }, false, 0, 0 },
+    { 1767526500, -48, { 229, 248, 1179, 799, 10149, 0, 143, 336, 0, 1219 }, false, 0, 0 },
+    { 1767526800, -136, { 253, 227, 1180, 817, 10148, 0, 124, 329, 0, 1220 }, false, 0, 0 },
+    { 1767527100, -161, { 138, 213, 1177, 801, 10147, 0, 105, 311, 0, 1217 }, false, 0, 0 },
+    { 1767527400, -395, { 155, 228, 1182, 792, 10150, 0, 95, 330, 0, 1222 }, false, 0, 0 },
+    { 1767527700, -102, { 140, 218, 1178, 820, 10152, 0, 96, 315, 0, 1218 }, false, 0, 0 },
+    { 1767528000, -312, { 182, 208, 1165, 822, 10152, 0, 127, 314, 0, 1205 }, false, 0, 0 },
+    { 1767528300, -176, { 234, 217, 1162, 849, 10153, 0, 161, 316, 0, 1202 }, false, 0, 0 },
+    { 1767528600, -159, { 224, 222, 1168, 809, 10152, 0, 106, 301, 0, 1208 }, false, 0, 0 },
+    { 1767528900, -583, { 194, 230, 1165, 840, 10152, 0, 143, 333, 0, 1205 }, false, 0, 0 },
+    { 1767529200, -215, { 217, 239, 1162, 860, 10150, 0, 136, 343, 0, 1202 }, false, 0, 0 },
+    { 1767529500, -178, { 201, 204, 1166, 850, 10150, 0, 134, 311, 0, 1206 }, false, 0, 0 },
+    { 1767529800, -540, { 252, 232, 1165, 835, 10149, 0, 160, 339, 0, 1205 }, false, 0, 0 },
+    { 1767530100, -567, { 276, 270, 1163, 842, 10150, 0, 166, 343, 0, 1203 }, false, 0, 0 },
+    { 1767530400, -221, { 191, 258, 1161, 847, 10152, 0, 137, 345, 0, 1201 }, false, 0, 0 },
+    { 1767530700, -474, { 214, 217, 1162, 845, 10151, 0, 147, 302, 0, 1202 }, false, 0, 0 },
+    { 1767531000, -81, { 177, 240, 1167, 821, 10150, 0, 116, 330, 0, 1207 }, false, 0, 0 },
+    { 1767531300, -296, { 203, 258, 1167, 843, 10147, 0, 155, 344, 0, 1207 }, false, 0, 0 },
+    { 1767531600, -544, { 193, 249, 1147, 894, 10146, 0, 127, 352, 0, 1187 }, false, 0, 0 },
+    { 1767531900, -63, { 222, 223, 1148, 873, 10144, 0, 169, 328, 0, 1188 }, false, 0, 0 },
+    { 1767532200, -166, { 287, 260, 1147, 884, 10145, 0, 189, 370, 0, 1187 }, false, 0, 0 },
+    { 1767532500, -419, { 238, 236, 1147, 883, 10147, 0, 183, 337, 0, 1187 }, false, 0, 0 },
+    { 1767532800, -29, { 266, 229, 1146, 892, 10147, 0, 205, 334, 0, 1186 }, false, 0, 0 },
+    { 1767533100, -454, { 374, 241, 1146, 878, 10147, 0, 238, 344, 0, 1186 }, false, 0, 0 },
+    { 1767533400, -55, { 184, 214, 1150, 877, 10149, 0, 122, 318, 0, 1190 }, false, 0, 0 },
+    { 1767533700, -51, { 191, 237, 1148, 869, 10148, 0, 131, 343, 0, 1188 }, false, 0, 0 },
+    { 1767534000, -290, { 275, 210, 1151, 867, 10148, 0, 191, 315, 0, 1191 }, false, 0, 0 },
+    { 1767534300, -375, { 266, 211, 1147, 864, 10148, 0, 163, 315, 0, 1187 }, false, 0, 0 },
+    { 1767534600, -7, { 187, 257, 1150, 857, 10147, 0, 121, 329, 0, 1190 }, false, 0, 0 },
+    { 1767534900, -252, { 190, 250, 1151, 858, 10148, 0, 128, 329, 0, 1191 }, false, 0, 0 },
+    { 1767535200, -345, { 189, 220, 1137, 902, 10148, 0, 137, 321, 0, 1177 }, false, 0, 0 },
+    { 1767535500, -563, { 181, 285, 1133, 916, 10147, 0, 89, 363, 0, 1173 }, false, 0, 0 },
+    { 1767535800, -494, { 169, 261, 1139, 904, 10145, 0, 110, 338, 0, 1179 }, false, 0, 0 },
+    { 1767536100, -174, { 173, 277, 1137, 907, 10144, 0, 89, 350, 0, 1177 }, false, 0, 0 },
+    { 1767536400, -387, { 128, 215, 1136, 900, 10143, 0, 98, 313, 0, 1176 }, false, 0, 0 },
+    { 1767536700, -126, { 135, 244, 1138, 897, 10145, 0, 56, 330, 0, 1178 }, false, 0, 0 },
+    { 1767537000, -404, { 86, 230, 1134, 915, 10146, 0, 69, 334, 0, 1174 }, false, 0, 0 },
+    { 1767537300, -20, { 85, 203, 1135, 909, 10146, 0, 47, 297, 0, 1175 }, false, 0, 0 },
+    { 1767537600, -55, { 117, 190, 1143, 874, 10144, 0, 84, 298, 0, 1183 }, false, 0, 0 },
+    { 1767537900, -525, { 177, 217, 1137, 915, 10145, 0, 114, 321, 0, 1177 }, false, 0, 0 },
+    { 1767538200, -361, { 187, 222, 1139, 895, 10147, 0, 108, 329, 0, 1179 }, false, 0, 0 },
+    { 1767538500, -541, { 160, 200, 1139, 909, 10146, 0, 123, 304, 0, 1179 }, false, 0, 0 },
+    { 1767538800, -129, { 97, 198, 1128, 934, 10146, 0, 68, 307, 0, 1168 }, false, 0, 0 },
+    { 1767539100, -171, { 105, 204, 1127, 934, 10144, 0, 54, 313, 0, 1167 }, false, 0, 0 },
+    { 1767539400, -130, { 179, 258, 1129, 921, 10144, 0, 139, 342, 0, 1169 }, false, 0, 0 },
+    { 1767539700, -169, { 229, 230, 1125, 957, 10145, 0, 116, 317, 0, 1165 }, false, 0, 0 },
+    { 1767540000, -81, { 171, 226, 1126, 934, 10147, 0, 126, 332, 0, 1166 }, false, 0, 0 },
+    { 1767540300, -192, { 199, 218, 1128, 946, 10146, 0, 116, 326, 0, 1168 }, false, 0, 0 },
+    { 1767540600, -80, { 222, 246, 1129, 928, 10144, 0, 138, 326, 0, 1169 }, false, 0, 0 },
+    { 1767540900, -324, { 162, 217, 1133, 936, 10145, 0, 98, 298, 0, 1173 }, false, 0, 0 },
+    { 1767541200, -165, { 302, 201, 1126, 910, 10145, 0, 122, 304, 0, 1166 }, false, 0, 0 },
+    { 1767541500, -51, { 170, 228, 1125, 951, 10146, 0, 93, 318, 0, 1165 }, false, 0, 0 },
+    { 1767541800, -249, { 215, 203, 1126, 939, 10146, 0, 128, 304, 0, 1166 }, false, 0, 0 },
+    { 1767542100, -295, { 252, 213, 1127, 921, 10144, 0, 136, 315, 0, 1167 }, false, 0, 0 },
+    { 1767542400, -513, { 200, 239, 1119, 935, 10144, 0, 155, 345, 0, 1159 }, false, 0, 0 },
+    { 1767542700, -519, { 149, 210, 1122, 942, 10146, 0, 85, 299, 0, 1162 }, false, 0, 0 },
+    { 1767543000, -338, { 204, 212, 1121, 949, 10145, 0, 117, 312, 0, 1161 }, false, 0, 0 },
+    { 1767543300, -412, { 194, 201, 1121, 970, 10142, 0, 116, 311, 0, 1161 }, false, 0, 0 },
+    { 1767543600, -71, { 181, 243, 1126, 939, 10140, 0, 104, 333, 0, 1166 }, false, 0, 0 },
+    { 1767543900, -136, { 185, 262, 1119, 963, 10142, 0, 134, 340, 0, 1159 }, false, 0, 0 },
+    { 1767544200, -67, { 173, 198, 1119, 958, 10141, 0, 109, 307, 0, 1159 }, false, 0, 0 },
+    { 1767544500, -174, { 132, 224, 1121, 933, 10142, 0, 75, 325, 0, 1161 }, false, 0, 0 },
+    { 1767544800, -567, { 137, 239, 1124, 926, 10141, 0, 82, 326, 0, 1164 }, false, 0, 0 },
+    { 1767545100, -203, { 178, 208, 1119, 949, 10143, 0, 98, 309, 0, 1159 }, false, 0, 0 },
+    { 1767545400, -467, { 116, 232, 1121, 940, 10142, 0, 80, 317, 0, 1161 }, false, 0, 0 },
+    { 1767545700, -176, { 55, 238, 1119, 958, 10142, 0, 23, 338, 0, 1159 }, false, 0, 0 },
+    { 1767546000, -95, { 95, 211, 1121, 950, 10141, 0, 45, 316, 0, 1161 }, false, 0, 0 },
+    { 1767546300, -268, { 120, 216, 1117, 946, 10141, 0, 41, 302, 0, 1157 }, false, 0, 0 },
+    { 1767546600, -496, { 103, 205, 1122, 960, 10140, 0, 75, 297, 0, 1162 }, false, 0, 0 },
+    { 1767546900, -447, { 149, 238, 1121, 956, 10140, 0, 115, 311, 0, 1161 }, false, 0, 0 },
+    { 1767547200, -24, { 129, 216, 1120, 953, 10138, 0, 66, 300, 0, 1160 }, false, 0, 0 },
+    { 1767547500, -82, { 98, 219, 1118, 950, 10137, 0, 60, 318, 0, 1158 }, false, 0, 0 },
+    { 1767547800, -503, { 151, 212, 1122, 943, 10137, 0, 61, 321, 0, 1162 }, false, 0, 0 },
+    { 1767548100, -235, { 150, 196, 1117, 934, 10137, 0, 79, 300, 0, 1157 }, false, 0, 0 },
+    { 1767548400, -148, { 160, 240, 1123, 940, 10137, 0, 42, 316, 0, 1163 }, false, 0, 0 },
+    { 1767548700, -415, { 152, 192, 1120, 959, 10138, 0, 43, 293, 0, 1160 }, false, 0, 0 },
+    { 1767549000, -591, { 111, 190, 1120, 950, 10137, 0, 34, 294, 0, 1160 }, false, 0, 0 },
+    { 1767549300, -460, { 113, 220, 1118, 958, 10140, 0, 50, 299, 0, 1158 }, false, 0, 0 },
+    { 1767549600, -371, { 152, 195, 1117, 968, 10136, 0, 86, 286, 0, 1157 }, false, 0, 0 },
+    { 1767549900, -570, { 135, 206, 1121, 945, 10138, 0, 52, 289, 0, 1161 }, false, 0, 0 },
+    { 1767550200, -126, { 125, 210, 1125, 940, 10138, 0, 74, 291, 0, 1165 }, false, 0, 0 },
+    { 1767550500, -123, { 144, 243, 1121, 939, 10139, 0, 102, 329, 0, 1161 }, false, 0, 0 },
+    { 1767550800, -251, { 172, 193, 1121, 927, 10140, 0, 60, 296, 0, 1161 }, false, 0, 0 },
+    { 1767551100, -589, { 159, 195, 1119, 952, 10140, 0, 79, 304, 0, 1159 }, false, 0, 0 },
+    { 1767551400, -137, { 117, 196, 1122, 941, 10142, 0, 76, 295, 0, 1162 }, false, 0, 0 },
+    { 1767551700, -131, { 146, 209, 1121, 942, 10140, 0, 75, 289, 0, 1161 }, false, 0, 0 },
+    { 1767552000, -165, { 123, 212, 1119, 937, 10143, 0, 81, 293, 0, 1159 }, false, 0, 0 },
+    { 1767552300, -176, { 117, 208, 1124, 937, 10146, 0, 84, 293, 0, 1164 }, false, 0, 0 },
+    { 1767552600, -560, { 119, 188, 1124, 942, 10144, 0, 59, 292, 0, 1164 }, false, 0, 0 },
+    { 1767552900, -532, { 59, 210, 1121, 954, 10143, 0, 18, 287, 0, 1161 }, false, 0, 0 },
+    { 1767553200, -6, { 81, 180, 1131, 924, 10144, 0, 44, 278, 0, 1171 }, false, 0, 0 },
+    { 1767553500, -180, { 60, 192, 1127, 933, 10143, 0, 32, 273, 0, 1167 }, false, 0, 0 },
+    { 1767553800, -89, { 16, 224, 1128, 915, 10146, 0, 0, 314, 0, 1168 }, false, 0, 0 },
+    { 1767554100, -524, { 97, 210, 1126, 913, 10146, 0, 17, 283, 0, 1166 }, false, 0, 0 },
+    { 1767554400, -547, { 114, 180, 1126, 926, 10145, 0, 0, 266, 0, 1166 }, false, 0, 0 },
+    { 1767554700, -333, { 78, 231, 1128, 930, 10145, 0, 31, 301, 0, 1168 }, false, 0, 0 },
+    { 1767555000, -56, { 53, 228, 1127, 934, 10147, 0, 21, 299, 0, 1167 }, false, 0, 0 },
+    { 1767555300, -565, { 67, 201, 1126, 935, 10145, 0, 48, 298, 0, 1166 }, false, 0, 0 },
+    { 1767555600, -136, { 87, 206, 1126, 922, 10146, 0, 37, 285, 0, 1166 }, false, 0, 0 },
+    { 1767555900, -344, { 84, 210, 1127, 921, 10147, 0, 69, 286, 0, 1167 }, false, 0, 0 },
+    { 1767556200, -519, { 181, 179, 1129, 911, 10148, 0, 66, 260, 0, 1169 }, false, 0, 0 },
+    { 1767556500, -230, { 131, 202, 1125, 943, 10148, 0, 46, 289, 0, 1165 }, false, 0, 0 },
+    { 1767556800, -539, { 119, 172, 1136, 922, 10147, 0, 71, 281, 0, 1176 }, false, 0, 0 },
+    { 1767557100, -233, { 131, 180, 1138, 900, 10147, 0, 77, 290, 0, 1178 }, false, 0, 0 },
+    { 1767557400, -352, { 205, 204, 1136, 897, 10147, 0, 115, 281, 0, 1176 }, false, 0, 0 },
+    { 1767557700, -53, { 129, 229, 1139, 913, 10147, 0, 84, 304, 0, 1179 }, false, 0, 0 },
+    { 1767558000, -139, { 122, 175, 1137, 914, 10144, 0, 74, 284, 0, 1177 }, false, 0, 0 },
+    { 1767558300, -78, { 141, 184, 1138, 907, 10143, 0, 55, 279, 0, 1178 }, false, 0, 0 },
+    { 1767558600, -171, { 123, 178, 1139, 899, 10142, 0, 69, 276, 0, 1179 }, false, 0, 0 },
+    { 1767558900, -288, { 43, 194, 1143, 893, 10142, 0, 4, 281, 0, 1183 }, false, 0, 0 },
+    { 1767559200, -272, { 99, 184, 1139, 905, 10143, 0, 51, 268, 0, 1179 }, false, 0, 0 },
+    { 1767559500, -211, { 48, 201, 1137, 890, 10144, 0, 19, 284, 0, 1177 }, false, 0, 0 },
+    { 1767559800, -386, { 76, 215, 1138, 891, 10147, 0, 0, 301, 0, 1178 }, false, 0, 0 },
+    { 1767560100, -389, { 55, 196, 1139, 903, 10146, 0, 0, 282, 0, 1179 }, false, 0, 0 },
+    { 1767560400, -197, { 32, 162, 1150, 876, 10147, 0, 15, 262, 0, 1190 }, false, 0, 0 },
+    { 1767560700, -125, { 10, 165, 1149, 893, 10148, 0, 0, 253, 0, 1189 }, false, 0, 0 },
+    { 1767561000, -459, { 20, 186, 1147, 876, 10148, 0, 4, 294, 0, 1187 }, false, 0, 0 },
+    { 1767561300, -515, { 28, 177, 1149, 882, 10146, 0, 24, 284, 0, 1189 }, false, 0, 0 },
+    { 1767561600, -239, { 47, 170, 1152, 877, 10143, 0, 0, 277, 0, 1192 }, false, 0, 0 },
+    { 1767561900, -542, { 39, 176, 1149, 884, 10141, 0, 23, 262, 0, 1189 }, false, 0, 0 },
+    { 1767562200, -590, { 62, 177, 1151, 867, 10139, 0, 16, 269, 0, 1191 }, false, 0, 0 },
+    { 1767562500, -553, { 48, 204, 1153, 858, 10138, 0, 9, 286, 0, 1193 }, false, 0, 0 },
+    { 1767562800, -9, { 64, 150, 1147, 892, 10138, 0, 48, 246, 0, 1187 }, false, 0, 0 },
+    { 1767563100, -583, { 46, 174, 1148, 855, 10138, 0, 27, 246, 0, 1188 }, false, 0, 0 },
+    { 1767563400, -479, { 62, 184, 1149, 878, 10137, 0, 42, 290, 0, 1189 }, false, 0, 0 },
+    { 1767563700, -395, { 101, 140, 1148, 888, 10139, 0, 54, 237, 0, 1188 }, false, 0, 0 },
+    { 1767564000, -121, { 63, 174, 1167, 817, 10139, 0, 12, 263, 0, 1207 }, false, 0, 0 },
+    { 1767564300, -516, { 72, 152, 1166, 833, 10139, 0, 38, 251, 0, 1206 }, false, 0, 0 },
+    { 1767564600, -473, { 143, 196, 1160, 865, 10141, 0, 83, 291, 0, 1200 }, false, 0, 0 },
+    { 1767564900, -404, { 92, 167, 1164, 839, 10140, 0, 54, 271, 0, 1204 }, false, 0, 0 },
+    { 1767565200, -477, { 181, 210, 1167, 824, 10139, 0, 99, 292, 0, 1207 }, false, 0, 0 },
+    { 1767565500, -403, { 153, 149, 1163, 824, 10139, 0, 117, 241, 0, 1203 }, false, 0, 0 },
+    { 1767565800, -248, { 122, 160, 1164, 844, 10141, 0, 72, 260, 0, 1204 }, false, 0, 0 },
+    { 1767566100, -332, { 192, 189, 1166, 838, 10141, 0, 137, 264, 0, 1206 }, false, 0, 0 },
+    { 1767566400, -294, { 197, 148, 1164, 849, 10139, 0, 134, 256, 0, 1204 }, false, 0, 0 },
+    { 1767566700, -505, { 221, 154, 1157, 840, 10140, 0, 124, 260, 0, 1197 }, false, 0, 0 },
+    { 1767567000, -462, { 174, 138, 1168, 825, 10137, 0, 138, 238, 0, 1208 }, false, 0, 0 },
+    { 1767567300, -363, { 177, 176, 1161, 846, 10136, 0, 131, 247, 0, 1201 }, false, 0, 0 },
+    { 1767567600, -333, { 91, 172, 1182, 780, 10138, 0, 58, 274, 0, 1222 }, false, 0, 0 },
+    { 1767567900, -500, { 155, 191, 1175, 813, 10138, 0, 103, 268, 0, 1215 }, false, 0, 0 },
+    { 1767568200, -344, { 175, 156, 1181, 796, 10141, 0, 100, 238, 0, 1221 }, false, 0, 0 },
+    { 1767568500, -473, { 103, 152, 1177, 801, 10142, 0, 64, 239, 0, 1217 }, false, 0, 0 },
+    { 1767568800, -361, { 195, 169, 1178, 808, 10141, 0, 114, 255, 0, 1218 }, false, 0, 0 },
+    { 1767569100, -19, { 187, 185, 1181, 808, 10142, 0, 99, 261, 0, 1221 }, false, 0, 0 },
+    { 1767569400, -323, { 193, 166, 1176, 837, 10143, 0, 144, 261, 0, 1216 }, false, 0, 0 },
+    { 1767569700, -129, { 269, 180, 1175, 814, 10142, 0, 158, 266, 0, 1215 }, false, 0, 0 },
+    { 1767570000, -67, { 167, 192, 1180, 785, 10141, 0, 110, 262, 0, 1220 }, false, 0, 0 },
+    { 1767570300, -599, { 247, 133, 1180, 790, 10141, 0, 125, 239, 0, 1220 }, false, 0, 0 },
+    { 1767570600, -292, { 202, 195, 1179, 805, 10144, 0, 101, 269, 0, 1219 }, false, 0, 0 },
+    { 1767570900, -402, { 172, 162, 1179, 790, 10142, 0, 82, 268, 0, 1219 }, false, 0, 0 },
+    { 1767571200, -233, { 204, 142, 1196, 755, 10141, 0, 144, 243, 0, 1236 }, false, 0, 0 },
+    { 1767571500, -199, { 179, 149, 1194, 786, 10141, 0, 137, 250, 0, 1234 }, false, 0, 0 },
+    { 1767571800, -19, { 141, 184, 1196, 760, 10142, 0, 94, 261, 0, 1236 }, false, 0, 0 },
+    { 1767572100, -214, { 159, 162, 1195, 775, 10143, 0, 125, 267, 0, 1235 }, false, 0, 0 },
+    { 1767572400, -102, { 186, 198, 1195, 774, 10141, 0, 119, 271, 0, 1235 }, false, 0, 0 },
+    { 1767572700, -279, { 113, 143, 1195, 744, 10139, 0, 68, 221, 0, 1235 }, false, 0, 0 },
+    { 1767573000, -244, { 70, 165, 1196, 774, 10138, 0, 42, 254, 0, 1236 }, false, 0, 0 },
+    { 1767573300, -138, { 142, 168, 1194, 773, 10138, 0, 69, 270, 0, 1234 }, false, 0, 0 },
+    { 1767573600, -595, { 99, 162, 1198, 735, 10136, 0, 33, 257, 0, 1238 }, false, 0, 0 },
+    { 1767573900, -310, { 74, 179, 1195, 761, 10137, 0, 16, 254, 0, 1235 }, false, 0, 0 },
+    { 1767574200, -16, { 163, 155, 1194, 760, 10136, 0, 51, 248, 0, 1234 }, false, 0, 0 },
+    { 1767574500, -161, { 91, 175, 1195, 751, 10135, 0, 54, 257, 0, 1235 }, false, 0, 0 },
+    { 1767574800, -59, { 114, 149, 1210, 741, 10133, 0, 55, 252, 0, 1250 }, false, 0, 0 },
+    { 1767575100, -529, { 92, 143, 1212, 701, 10133, 0, 71, 233, 0, 1252 }, false, 0, 0 },
+    { 1767575400, -562, { 153, 173, 1208, 739, 10134, 0, 80, 269, 0, 1248 }, false, 0, 0 },
+    { 1767575700, -299, { 130, 161, 1211, 705, 10133, 0, 67, 242, 0, 1251 }, false, 0, 0 },
+    { 1767576000, -321, { 137, 153, 1212, 739, 10136, 0, 51, 229, 0, 1252 }, false, 0, 0 },
+    { 1767576300, -293, { 155, 162, 1209, 721, 10137, 0, 113, 241, 0, 1249 }, false, 0, 0 },
+    { 1767576600, -528, { 121, 170, 1211, 726, 10136, 0, 75, 257, 0, 1251 }, false, 0, 0 },
+    { 1767576900, -502, { 137, 159, 1209, 730, 10139, 0, 64, 252, 0, 1249 }, false, 0, 0 },
+    { 1767577200, -496, { 157, 178, 1208, 716, 10140, 0, 101, 268, 0, 1248 }, false, 0, 0 },
+    { 1767577500, -498, { 110, 199, 1211, 713, 10141, 0, 69, 273, 0, 1251 }, false, 0, 0 },
+    { 1767577800, -203, { 61, 162, 1209, 740, 10138, 0, 32, 232, 0, 1249 }, false, 0, 0 },
+    { 1767578100, -154, { 111, 161, 1210, 726, 10139, 0, 62, 255, 0, 1250 }, false, 0, 0 },
+    { 1767578400, -226, { 141, 145, 1223, 683, 10139, 0, 49, 226, 0, 1263 }, false, 0, 0 },
+    { 1767578700, -470, { 72, 195, 1224, 687, 10140, 0, 49, 268, 0, 1264 }, false, 0, 0 },
+    { 1767579000, -72, { 129, 144, 1222, 685, 10143, 0, 59, 252, 0, 1262 }, false, 0, 0 },
+    { 1767579300, -194, { 16, 145, 1222, 692, 10144, 0, 9, 238, 0, 1262 }, false, 0, 0 },
+    { 1767579600, -534, { 1, 148, 1222, 690, 10144, 0, 0, 251, 0, 1262 }, false, 0, 0 },
+    { 1767579900, -400, { 25, 151, 1221, 688, 10144, 0, 0, 232, 0, 1261 }, false, 0, 0 },
+    { 1767580200, -27, { 88, 174, 1218, 701, 10144, 0, 23, 259, 0, 1258 }, false, 0, 0 },
+    { 1767580500, -588, { 72, 149, 1223, 700, 10142, 0, 47, 235, 0, 1263 }, false, 0, 0 },
+    { 1767580800, -545, { 84, 160, 1219, 693, 10140, 0, 14, 239, 0, 1259 }, false, 0, 0 },
+    { 1767581100, -186, { 83, 160, 1222, 703, 10140, 0, 21, 238, 0, 1262 }, false, 0, 0 },
+    { 1767581400, -285, { 7, 168, 1222, 691, 10143, 0, 0, 251, 0, 1262 }, false, 0, 0 },
+    { 1767581700, -220, { 52, 183, 1222, 705, 10143, 0, 25, 266, 0, 1262 }, false, 0, 0 },
+    { 1767582000, -494, { 35, 139, 1231, 676, 10142, 0, 15, 232, 0, 1271 }, false, 0, 0 },
+    { 1767582300, -527, { 27, 172, 1227, 671, 10143, 0, 0, 252, 0, 1267 }, false, 0, 0 },
+    { 1767582600, -370, { 69, 169, 1233, 664, 10142, 0, 23, 265, 0, 1273 }, false, 0, 0 },
+    { 1767582900, -191, { 57, 156, 1231, 659, 10143, 0, 31, 262, 0, 1271 }, false, 0, 0 },
+    { 1767583200, -567, { 58, 146, 1228, 682, 10142, 0, 15, 232, 0, 1268 }, false, 0, 0 },
+    { 1767583500, -123, { 60, 144, 1233, 662, 10142, 0, 55, 240, 0, 1273 }, false, 0, 0 },
+    { 1767583800, -182, { 37, 128, 1233, 659, 10143, 0, 21, 227, 0, 1273 }, false, 0, 0 },
+    { 1767584100, -477, { 35, 172, 1231, 668, 10144, 0, 18, 264, 0, 1271 }, false, 0, 0 },
+    { 1767584400, -153, { 79, 158, 1234, 690, 10147, 0, 36, 263, 0, 1274 }, false, 0, 0 },
+    { 1767584700, -457, { 36, 141, 1229, 683, 10145, 0, 4, 251, 0, 1269 }, false, 0, 0 },
+    { 1767585000, -431, { 56, 182, 1229, 679, 10147, 0, 28, 262, 0, 1269 }, false, 0, 0 },
+    { 1767585300, -243, { 75, 163, 1229, 659, 10144, 0, 51, 238, 0, 1269 }, false, 0, 0 },
+    { 1767585600, -470, { 63, 173, 1236, 645, 10142, 0, 6, 274, 0, 1276 }, false, 0, 0 },
+    { 1767585900, -121, { 112, 164, 1236, 650, 10140, 0, 18, 249, 0, 1276 }, false, 0, 0 },
+    { 1767586200, -164, { 73, 189, 1242, 642, 10142, 0, 52, 264, 0, 1282 }, false, 0, 0 },
+    { 1767586500, -349, { 76, 167, 1236, 629, 10142, 0, 37, 268, 0, 1276 }, false, 0, 0 },
+    { 1767586800, -14, { 48, 183, 1233, 655, 10140, 0, 11, 279, 0, 1273 }, false, 0, 0 },
+    { 1767587100, -459, { 27, 160, 1239, 649, 10140, 0, 9, 258, 0, 1279 }, false, 0, 0 },
+    { 1767587400, -584, { 49, 174, 1235, 652, 10141, 0, 0, 264, 0, 1275 }, false, 0, 0 },
+    { 1767587700, -9, { 4, 152, 1234, 659, 10140, 0, 0, 242, 0, 1274 }, false, 0, 0 },
+    { 1767588000, -208, { 32, 139, 1237, 624, 10139, 0, 0, 224, 0, 1277 }, false, 0, 0 },
+    { 1767588300, -485, { 47, 144, 1240, 637, 10140, 0, 1, 248, 0, 1280 }, false, 0, 0 },
+    { 1767588600, -599, { 139, 173, 1237, 632, 10139, 0, 94, 273, 0, 1277 }, false, 0, 0 },
+    { 1767588900, -79, { 146, 143, 1240, 659, 10138, 0, 55, 224, 0, 1280 }, false, 0, 0 },
+    { 1767589200, -511, { 113, 165, 1241, 655, 10140, 0, 66, 236, 0, 1281 }, false, 0, 0 },
+    { 1767589500, -530, { 142, 161, 1242, 638, 10140, 0, 75, 246, 0, 1282 }, false, 0, 0 },
+    { 1767589800, -157, { 111, 177, 1242, 639, 10139, 0, 82, 273, 0, 1282 }, false, 0, 0 },
+    { 1767590100, -529, { 192, 183, 1239, 663, 10137, 0, 113, 256, 0, 1279 }, false, 0, 0 },
+    { 1767590400, -348, { 103, 156, 1237, 663, 10138, 0, 64, 246, 0, 1277 }, false, 0, 0 },
+    { 1767590700, -513, { 100, 154, 1240, 668, 10137, 0, 39, 258, 0, 1280 }, false, 0, 0 },
+    { 1767591000, -130, { 74, 168, 1239, 652, 10135, 0, 36, 274, 0, 1279 }, false, 0, 0 },
+    { 1767591300, -50, { 106, 187, 1239, 649, 10135, 0, 58, 262, 0, 1279 }, false, 0, 0 },
+    { 1767591600, -149, { 117, 156, 1239, 648, 10134, 0, 71, 245, 0, 1279 }, false, 0, 0 },
+    { 1767591900, -578, { 76, 182, 1240, 630, 10135, 0, 51, 259, 0, 1280 }, false, 0, 0 },
+    { 1767592200, -72, { 107, 159, 1241, 656, 10137, 0, 46, 246, 0, 1281 }, false, 0, 0 },
+    { 1767592500, -481, { 199, 135, 1241, 659, 10137, 0, 75, 238, 0, 1281 }, false, 0, 0 },
+    { 1767592800, -559, { 91, 182, 1240, 650, 10136, 0, 46, 259, 0, 1280 }, false, 0, 0 },
+    { 1767593100, -456, { 62, 156, 1238, 644, 10134, 0, 34, 264, 0, 1278 }, false, 0, 0 },
+    { 1767593400, -270, { 28, 175, 1235, 654, 10132, 0, 1, 265, 0, 1275 }, false, 0, 0 },
+    { 1767593700, -63, { 97, 181, 1237, 671, 10134, 0, 39, 259, 0, 1277 }, false, 0, 0 },
+    { 1767594000, -3, { 25, 176, 1235, 653, 10132, 0, 16, 259, 0, 1275 }, false, 0, 0 },
+    { 1767594300, -24, { 44, 192, 1236, 682, 10132, 0, 29, 276, 0, 1276 }, false, 0, 0 },
+    { 1767594600, -231, { 65, 166, 1236, 659, 10130, 0, 52, 255, 0, 1276 }, false, 0, 0 },
+    { 1767594900, -331, { 76, 199, 1239, 654, 10135, 0, 13, 279, 0, 1279 }, false, 0, 0 },
+    { 1767595200, -452, { 26, 194, 1243, 643, 10136, 0, 0, 268, 0, 1283 }, false, 0, 0 },
+    { 1767595500, -416, { 54, 199, 1236, 651, 10139, 0, 31, 295, 0, 1276 }, false, 0, 0 },
+    { 1767595800, -157, { 16, 156, 1236, 656, 10140, 0, 8, 259, 0, 1276 }, false, 0, 0 },
+    { 1767596100, -315, { 41, 176, 1238, 659, 10142, 0, 0, 283, 0, 1278 }, false, 0, 0 },
+    { 1767596400, -397, { 54, 168, 1233, 673, 10140, 0, 0, 267, 0, 1273 }, false, 0, 0 },
+    { 1767596700, -280, { 95, 180, 1232, 680, 10139, 0, 51, 261, 0, 1272 }, false, 0, 0 },
+    { 1767597000, -523, { 58, 182, 1230, 681, 10137, 0, 27, 278, 0, 1270 }, false, 0, 0 },
+    { 1767597300, -460, { 128, 150, 1231, 676, 10141, 0, 58, 251, 0, 1271 }, false, 0, 0 },
+    { 1767597600, -117, { 77, 177, 1234, 676, 10141, 0, 51, 281, 0, 1274 }, false, 0, 0 },
+    { 1767597900, -144, { 117, 188, 1236, 673, 10140, 0, 51, 297, 0, 1276 }, false, 0, 0 },
+    { 1767598200, -265, { 84, 196, 1233, 664, 10138, 0, 36, 296, 0, 1273 }, false, 0, 0 },
+    { 1767598500, -546, { 105, 190, 1230, 666, 10140, 0, 86, 293, 0, 1270 }, false, 0, 0 },
+    { 1767598800, -165, { 107, 201, 1228, 668, 10141, 0, 75, 293, 0, 1268 }, false, 0, 0 },
+    { 1767599100, -450, { 83, 173, 1234, 671, 10140, 0, 49, 282, 0, 1274 }, false, 0, 0 },
+    { 1767599400, -237, { 84, 197, 1230, 676, 10139, 0, 43, 279, 0, 1270 }, false, 0, 0 },
+    { 1767599700, -455, { 46, 183, 1236, 661, 10139, 0, 28, 271, 0, 1276 }, false, 0, 0 },
+    { 1767600000, -164, { 35, 203, 1223, 701, 10138, 0, 25, 283, 0, 1263 }, false, 0, 0 },
+    { 1767600300, -103, { 72, 182, 1221, 693, 10138, 0, 42, 277, 0, 1261 }, false, 0, 0 },
+    { 1767600600, -36, { 66, 158, 1221, 690, 10140, 0, 0, 255, 0, 1261 }, false, 0, 0 },
+    { 1767600900, -541, { 43, 165, 1223, 696, 10143, 0, 23, 269, 0, 1263 }, false, 0, 0 },
+    { 1767601200, -488, { 79, 199, 1222, 703, 10142, 0, 55, 302, 0, 1262 }, false, 0, 0 },
+    { 1767601500, -301, { 125, 174, 1223, 677, 10142, 0, 24, 283, 0, 1263 }, false, 0, 0 },
+    { 1767601800, -180, { 49, 199, 1221, 683, 10143, 0, 17, 283, 0, 1261 }, false, 0, 0 },
+    { 1767602100, -580, { 93, 222, 1224, 692, 10146, 0, 33, 309, 0, 1264 }, false, 0, 0 },
+    { 1767602400, -136, { 50, 200, 1221, 686, 10146, 0, 21, 276, 0, 1261 }, false, 0, 0 },
+    { 1767602700, -95, { 78, 176, 1220, 697, 10146, 0, 38, 271, 0, 1260 }, false, 0, 0 },
+    { 1767603000, -417, { 1, 209, 1223, 712, 10146, 0, 0, 293, 0, 1263 }, false, 0, 0 },
+    { 1767603300, -481, { 13, 233, 1218, 703, 10150, 0, 0, 304, 0, 1258 }, false, 0, 0 },
+    { 1767603600, -550, { 4, 198, 1215, 700, 10151, 0, 0, 285, 0, 1255 }, false, 0, 0 },
+    { 1767603900, -570, { 66, 176, 1208, 728, 10153, 0, 40, 283, 0, 1248 }, false, 0, 0 },
+    { 1767604200, -43, { 90, 198, 1210, 712, 10154, 0, 12, 276, 0, 1250 }, false, 0, 0 },
+    { 1767604500, -528, { 70, 180, 1209, 711, 10155, 0, 11, 287, 0, 1249 }, false, 0, 0 },
+    { 1767604800, -9, { 5, 195, 1209, 713, 10154, 0, 0, 297, 0, 1249 }, false, 0, 0 },
+    { 1767605100, -6, { 50, 224, 1211, 731, 10153, 0, 0, 299, 0, 1251 }, false, 0, 0 },
+    { 1767605400, -480, { 44, 247, 1211, 707, 10154, 0, 6, 318, 0, 1251 }, false, 0, 0 },
+    { 1767605700, -484, { 39, 234, 1209, 713, 10155, 0, 0, 326, 0, 1249 }, false, 0, 0 },
+    { 1767606000, -470, { 42, 228, 1206, 741, 10156, 0, 2, 300, 0, 1246 }, false, 0, 0 },
+    { 1767606300, -231, { 93, 201, 1208, 748, 10156, 0, 34, 309, 0, 1248 }, false, 0, 0 },
+    { 1767606600, -588, { 15, 222, 1210, 709, 10158, 0, 0, 309, 0, 1250 }, false, 0, 0 },
+    { 1767606900, -554, { 59, 224, 1208, 726, 10159, 0, 39, 299, 0, 1248 }, false, 0, 0 },
+    { 1767607200, -48, { 79, 210, 1194, 765, 10158, 0, 29, 312, 0, 1234 }, false, 0, 0 },
+    { 1767607500, -439, { 95, 227, 1194, 783, 10156, 0, 51, 299, 0, 1234 }, false, 0, 0 },
+    { 1767607800, -253, { 95, 209, 1194, 759, 10156, 0, 66, 308, 0, 1234 }, false, 0, 0 },
+    { 1767608100, -358, { 148, 233, 1196, 754, 10154, 0, 91, 313, 0, 1236 }, false, 0, 0 },
+    { 1767608400, -21, { 109, 215, 1197, 755, 10156, 0, 37, 286, 0, 1237 }, false, 0, 0 },
+    { 1767608700, -82, { 114, 184, 1192, 755, 10157, 0, 75, 281, 0, 1232 }, false, 0, 0 },
+    { 1767609000, -260, { 117, 213, 1195, 762, 10160, 0, 79, 320, 0, 1235 }, false, 0, 0 },
+    { 1767609300, -345, { 159, 196, 1194, 770, 10159, 0, 75, 297, 0, 1234 }, false, 0, 0 },
+    { 1767609600, -222, { 191, 210, 1195, 758, 10159, 0, 133, 316, 0, 1235 }, false, 0, 0 },
+    { 1767609900, -118, { 246, 224, 1194, 769, 10157, 0, 190, 323, 0, 1234 }, false, 0, 0 },
+    { 1767610200, -128, { 247, 215, 1193, 770, 10157, 0, 164, 301, 0, 1233 }, false, 0, 0 },
+    { 1767610500, -259, { 249, 199, 1195, 758, 10157, 0, 143, 301, 0, 1235 }, false, 0, 0 },
+    { 1767610800, -144, { 249, 173, 1181, 787, 10153, 0, 163, 281, 0, 1221 }, false, 0, 0 },
+    { 1767611100, -412, { 228, 216, 1178, 802, 10153, 0, 176, 289, 0, 1218 }, false, 0, 0 },
+    { 1767611400, -448, { 237, 208, 1177, 812, 10154, 0, 171, 314, 0, 1217 }, false, 0, 0 },
+    { 1767611700, -313, { 224, 232, 1177, 809, 10154, 0, 155, 315, 0, 1217 }, false, 0, 0 },
+    { 1767612000, -503, { 212, 216, 1178, 799, 10155, 0, 158, 310, 0, 1218 }, false, 0, 0 },
+    { 1767612300, -237, { 258, 214, 1180, 796, 10157, 0, 185, 304, 0, 1220 }, false, 0, 0 },
+    { 1767612600, -449, { 259, 225, 1181, 791, 10160, 0, 161, 324, 0, 1221 }, false, 0, 0 },
+    { 1767612900, -20, { 330, 245, 1182, 804, 10161, 0, 244, 334, 0, 1222 }, false, 0, 0 },
+    { 1767613200, -181, { 329, 222, 1181, 787, 10160, 0, 232, 312, 0, 1221 }, false, 0, 0 },
+    { 1767613500, -592, { 246, 222, 1181, 795, 10161, 0, 182, 321, 0, 1221 }, false, 0, 0 },
+    { 1767613800, -370, { 321, 216, 1181, 813, 10161, 0, 231, 311, 0, 1221 }, false, 0, 0 },
+    { 1767614100, -586, { 337, 235, 1182, 787, 10166, 0, 209, 323, 0, 1222 }, false, 0, 0 },
+    { 1767614400, -434, { 318, 207, 1164, 838, 10166, 0, 242, 305, 0, 1204 }, false, 0, 0 },
+    { 1767614700, -522, { 338, 217, 1165, 821, 10164, 0, 220, 310, 0, 1205 }, false, 0, 0 },
+    { 1767615000, -408, { 430, 241, 1165, 821, 10164, 0, 254, 335, 0, 1205 }, false, 0, 0 },
+    { 1767615300, -320, { 339, 206, 1165, 835, 10164, 0, 249, 315, 0, 1205 }, false, 0, 0 },
+    { 1767615600, -409, { 329, 256, 1162, 858, 10165, 0, 246, 336, 0, 1202 }, false, 0, 0 },
+    { 1767615900, -575, { 363, 224, 1164, 842, 10165, 0, 262, 313, 0, 1204 }, false, 0, 0 },
+    { 1767616200, -252, { 395, 194, 1164, 848, 10166, 0, 260, 303, 0, 1204 }, false, 0, 0 },
+    { 1767616500, -298, { 381, 227, 1167, 838, 10163, 0, 227, 309, 0, 1207 }, false, 0, 0 },
+    { 1767616800, -542, { 289, 225, 1162, 837, 10161, 0, 217, 331, 0, 1202 }, false, 0, 0 },
+    { 1767617100, -365, { 364, 212, 1166, 819, 10161, 0, 248, 319, 0, 1206 }, false, 0, 0 },
+    { 1767617400, -422, { 345, 221, 1166, 826, 10163, 0, 240, 327, 0, 1206 }, false, 0, 0 },
+    { 1767617700, -26, { 315, 226, 1164, 831, 10162, 0, 226, 323, 0, 1204 }, false, 0, 0 },
+    { 1767618000, -78, { 235, 226, 1150, 880, 10161, 0, 163, 310, 0, 1190 }, false, 0, 0 },
+    { 1767618300, -352, { 276, 206, 1147, 858, 10163, 0, 179, 314, 0, 1187 }, false, 0, 0 },
+    { 1767618600, -195, { 298, 225, 1146, 878, 10163, 0, 219, 324, 0, 1186 }, false, 0, 0 },
+    { 1767618900, -142, { 288, 237, 1153, 858, 10164, 0, 211, 338, 0, 1193 }, false, 0, 0 },
+    { 1767619200, -485, { 292, 236, 1152, 859, 10165, 0, 197, 322, 0, 1192 }, false, 0, 0 },
+    { 1767619500, -284, { 266, 247, 1151, 867, 10163, 0, 175, 320, 0, 1191 }, false, 0, 0 },
+    { 1767619800, -31, { 309, 246, 1152, 866, 10163, 0, 182, 322, 0, 1192 }, false, 0, 0 },
+    { 1767620100, -308, { 263, 231, 1154, 860, 10162, 0, 199, 339, 0, 1194 }, false, 0, 0 },
+    { 1767620400, -416, { 222, 258, 1149, 873, 10161, 0, 169, 331, 0, 1189 }, false, 0, 0 },
+    { 1767620700, -574, { 223, 198, 1149, 884, 10159, 0, 167, 305, 0, 1189 }, false, 0, 0 },
+    { 1767621000, -580, { 308, 231, 1153, 878, 10156, 0, 167, 341, 0, 1193 }, false, 0, 0 },
+    { 1767621300, -75, { 248, 221, 1151, 878, 10156, 0, 154, 308, 0, 1191 }, false, 0, 0 },
+    { 1767621600, -213, { 276, 224, 1140, 907, 10157, 0, 177, 323, 0, 1180 }, false, 0, 0 },
+    { 1767621900, -90, { 216, 244, 1137, 913, 10156, 0, 163, 326, 0, 1177 }, false, 0, 0 },
+    { 1767622200, -407, { 267, 242, 1135, 916, 10154, 0, 191, 350, 0, 1175 }, false, 0, 0 },
+    { 1767622500, -73, { 204, 258, 1134, 921, 10156, 0, 150, 333, 0, 1174 }, false, 0, 0 },
+    { 1767622800, -293, { 240, 225, 1137, 900, 10155, 0, 186, 330, 0, 1177 }, false, 0, 0 },
+    { 1767623100, -490, { 258, 207, 1138, 918, 10154, 0, 193, 309, 0, 1178 }, false, 0, 0 },
+    { 1767623400, -538, { 229, 223, 1139, 887, 10156, 0, 160, 317, 0, 1179 }, false, 0, 0 },
+    { 1767623700, -92, { 223, 212, 1136, 902, 10155, 0, 164, 313, 0, 1176 }, false, 0, 0 },
+    { 1767624000, -123, { 229, 230, 1139, 899, 10154, 0, 178, 317, 0, 1179 }, false, 0, 0 },
+    { 1767624300, -306, { 211, 260, 1142, 903, 10154, 0, 127, 332, 0, 1182 }, false, 0, 0 },
+    { 1767624600, -555, { 181, 238, 1137, 906, 10155, 0, 128, 318, 0, 1177 }, false, 0, 0 },
+    { 1767624900, -85, { 201, 241, 1136, 902, 10156, 0, 119, 340, 0, 1176 }, false, 0, 0 },
+    { 1767625200, -154, { 248, 236, 1125, 937, 10156, 0, 176, 332, 0, 1165 }, false, 0, 0 },
+    { 1767625500, -94, { 170, 220, 1126, 931, 10156, 0, 106, 329, 0, 1166 }, false, 0, 0 },
+    { 1767625800, -93, { 203, 226, 1129, 929, 10156, 0, 162, 318, 0, 1169 }, false, 0, 0 },
+    { 1767626100, -107, { 180, 219, 1125, 921, 10156, 0, 131, 321, 0, 1165 }, false, 0, 0 },
+    { 1767626400, -389, { 167, 260, 1125, 948, 10158, 0, 105, 359, 0, 1165 }, false, 0, 0 },
+    { 1767626700, -291, { 187, 215, 1125, 943, 10156, 0, 141, 323, 0, 1165 }, false, 0, 0 },
+    { 1767627000, -245, { 290, 253, 1128, 922, 10156, 0, 210, 332, 0, 1168 }, false, 0, 0 },
+    { 1767627300, -447, { 260, 233, 1129, 918, 10155, 0, 181, 323, 0, 1169 }, false, 0, 0 },
+    { 1767627600, -596, { 261, 242, 1125, 937, 10156, 0, 198, 330, 0, 1165 }, false, 0, 0 },
+    { 1767627900, -324, { 307, 226, 1128, 910, 10157, 0, 216, 335, 0, 1168 }, false, 0, 0 },
+    { 1767628200, -492, { 293, 229, 1127, 931, 10157, 0, 212, 333, 0, 1167 }, false, 0, 0 },
+    { 1767628500, -161, { 276, 202, 1125, 940, 10157, 0, 192, 309, 0, 1165 }, false, 0, 0 },
+    { 1767628800, -529, { 380, 233, 1124, 940, 10156, 0, 238, 329, 0, 1164 }, false, 0, 0 },
+    { 1767629100, -302, { 333, 251, 1123, 935, 10156, 0, 246, 335, 0, 1163 }, false, 0, 0 },
+    { 1767629400, -22, { 328, 266, 1121, 942, 10155, 0, 234, 347, 0, 1161 }, false, 0, 0 },
+    { 1767629700, -236, { 324, 256, 1121, 946, 10153, 0, 215, 334, 0, 1161 }, false, 0, 0 },
+    { 1767630000, -576, { 342, 228, 1122, 939, 10153, 0, 254, 305, 0, 1162 }, false, 0, 0 },
+    { 1767630300, -54, { 416, 276, 1122, 962, 10152, 0, 273, 357, 0, 1162 }, false, 0, 0 },
+    { 1767630600, -401, { 405, 210, 1122, 935, 10151, 0, 284, 310, 0, 1162 }, false, 0, 0 },
+    { 1767630900, -248, { 431, 233, 1122, 941, 10151, 0, 288, 325, 0, 1162 }, false, 0, 0 },
+    { 1767631200, -366, { 434, 222, 1121, 945, 10152, 0, 311, 330, 0, 1161 }, false, 0, 0 },
+    { 1767631500, -170, { 395, 224, 1125, 948, 10152, 0, 289, 313, 0, 1165 }, false, 0, 0 },
+    { 1767631800, -279, { 393, 220, 1121, 942, 10150, 0, 297, 302, 0, 1161 }, false, 0, 0 },
+    { 1767632100, -458, { 420, 254, 1124, 941, 10150, 0, 296, 337, 0, 1164 }, false, 0, 0 },
+    { 1767632400, -424, { 424, 185, 1118, 960, 10151, 0, 294, 290, 0, 1158 }, false, 0, 0 },
+    { 1767632700, -551, { 377, 244, 1119, 947, 10154, 0, 290, 319, 0, 1159 }, false, 0, 0 },
+    { 1767633000, -382, { 341, 228, 1119, 958, 10155, 0, 251, 336, 0, 1159 }, false, 0, 0 },
+    { 1767633300, -22, { 380, 253, 1118, 944, 10153, 0, 278, 342, 0, 1158 }, false, 0, 0 },
+    { 1767633600, -476, { 376, 232, 1115, 956, 10152, 0, 277, 333, 0, 1155 }, false, 0, 0 },
+    { 1767633900, -510, { 404, 265, 1123, 950, 10151, 0, 284, 346, 0, 1163 }, false, 0, 0 },
+    { 1767634200, -241, { 411, 249, 1118, 934, 10150, 0, 309, 326, 0, 1158 }, false, 0, 0 },
+    { 1767634500, -355, { 436, 218, 1119, 941, 10149, 0, 309, 301, 0, 1159 }, false, 0, 0 },
+    { 1767634800, -600, { 438, 216, 1122, 945, 10152, 0, 303, 320, 0, 1162 }, false, 0, 0 },
+    { 1767635100, -155, { 444, 242, 1118, 950, 10154, 120, 322, 335, 10, 1158 }, true, 340, -497 },
+    { 1767635400, -34, { 439, 278, 1119, 950, 10154, 96, 303, 357, 18, 1159 }, true, 251, -380 },
+    { 1767635700, -93, { 445, 214, 1120, 930, 10155, 0, 295, 304, 18, 1160 }, false, 0, 0 },
+    { 1767636000, -277, { 413, 180, 1122, 946, 10154, 24, 302, 289, 20, 1162 }, true, 120, -383 },
+    { 1767636300, -40, { 361, 244, 1117, 951, 10155, 24, 273, 321, 22, 1157 }, true, 102, -109 },
+    { 1767636600, -432, { 402, 229, 1122, 949, 10154, 144, 287, 336, 34, 1162 }, true, 371, -134 },
+    { 1767636900, -486, { 439, 231, 1125, 944, 10153, 48, 331, 315, 38, 1165 }, true, 134, -224 },
+    { 1767637200, -195, { 404, 234, 1123, 946, 10153, 72, 283, 309, 44, 1163 }, true, 230, -313 },
+    { 1767637500, -506, { 438, 254, 1119, 951, 10150, 96, 327, 335, 52, 1159 }, true, 279, -107 },
+    { 1767637800, -194, { 492, 209, 1122, 945, 10149, 144, 325, 312, 64, 1162 }, true, 403, -295 },
+    { 1767638100, -187, { 462, 242, 1118, 970, 10149, 24, 331, 322, 66, 1158 }, true, 117, -355 },
+    { 1767638400, -71, { 455, 245, 1120, 938, 10149, 144, 306, 328, 78, 1160 }, true, 362, -580 },
+    { 1767638700, -506, { 425, 210, 1121, 941, 10149, 72, 295, 311, 84, 1161 }, true, 196, -355 },
+    { 1767639000, -569, { 404, 229, 1125, 942, 10148, 0, 310, 302, 84, 1165 }, false, 0, 0 },
+    { 1767639300, -494, { 388, 208, 1121, 942, 10151, 144, 289, 311, 96, 1161 }, true, 398, -85 },
+    { 1767639600, -386, { 386, 230, 1127, 918, 10150, 144, 289, 318, 108, 1167 }, true, 404, -523 },
+    { 1767639900, -223, { 362, 243, 1130, 923, 10151, 0, 269, 340, 108, 1170 }, false, 0, 0 },
+    { 1767640200, -567, { 336, 225, 1125, 927, 10152, 0, 225, 333, 108, 1165 }, false, 0, 0 },
+    { 1767640500, -361, { 343, 223, 1127, 928, 10154, 0, 213, 301, 108, 1167 }, false, 0, 0 },
+    { 1767640800, -165, { 268, 230, 1127, 923, 10154, 0, 198, 325, 108, 1167 }, false, 0, 0 },
+    { 1767641100, -140, { 302, 202, 1125, 927, 10154, 0, 215, 290, 108, 1165 }, false, 0, 0 },
+    { 1767641400, -185, { 237, 242, 1128, 930, 10153, 0, 164, 337, 108, 1168 }, false, 0, 0 },
+    { 1767641700, -490, { 281, 207, 1126, 945, 10153, 0, 197, 308, 108, 1166 }, false, 0, 0 },
+    { 1767642000, -255, { 248, 201, 1128, 946, 10154, 0, 186, 303, 108, 1168 }, false, 0, 0 },
+    { 1767642300, -454, { 277, 207, 1128, 909, 10153, 0, 181, 282, 108, 1168 }, false, 0, 0 },
+    { 1767642600, -3, { 247, 235, 1128, 913, 10151, 0, 145, 312, 108, 1168 }, false, 0, 0 },
+    { 1767642900, -453, { 214, 231, 1126, 921, 10152, 0, 161, 318, 108, 1166 }, false, 0, 0 },
+    { 1767643200, -538, { 222, 200, 1139, 905, 10154, 0, 170, 286, 108, 1179 }, false, 0, 0 },
+    { 1767643500, -113, { 237, 186, 1136, 918, 10155, 0, 182, 274, 108, 1176 }, false, 0, 0 },
+    { 1767643800, -33, { 313, 242, 1140, 901, 10155, 0, 192, 328, 108, 1180 }, false, 0, 0 },
+    { 1767644100, -87, { 230, 232, 1136, 905, 10155, 0, 164, 315, 108, 1176 }, false, 0, 0 },
+    { 1767644400, -537, { 312, 214, 1138, 912, 10155, 0, 226, 313, 108, 1178 }, false, 0, 0 },
+    { 1767644700, -357, { 283, 211, 1137, 900, 10154, 0, 192, 308, 108, 1177 }, false, 0, 0 },
+    { 1767645000, -269, { 308, 188, 1139, 911, 10155, 0, 212, 293, 108, 1179 }, false, 0, 0 },
+    { 1767645300, -35, { 303, 197, 1136, 919, 10155, 0, 211, 303, 108, 1176 }, false, 0, 0 },
+    { 1767645600, -200, { 332, 236, 1137, 914, 10154, 0, 228, 324, 108, 1177 }, false, 0, 0 },
+    { 1767645900, -243, { 353, 213, 1137, 904, 10155, 0, 253, 323, 108, 1177 }, false, 0, 0 },
+    { 1767646200, -216, { 333, 191, 1137, 885, 10154, 0, 251, 287, 108, 1177 }, false, 0, 0 },
+    { 1767646500, -401, { 335, 170, 1135, 914, 10153, 0, 226, 278, 108, 1175 }, false, 0, 0 },
+    { 1767646800, -307, { 352, 211, 1150, 869, 10152, 0, 220, 295, 108, 1190 }, false, 0, 0 },
+    { 1767647100, -354, { 319, 231, 1147, 884, 10152, 0, 196, 323, 108, 1187 }, false, 0, 0 },
+    { 1767647400, -528, { 353, 242, 1149, 883, 10152, 0, 250, 314, 108, 1189 }, false, 0, 0 },
+    { 1767647700, -129, { 373, 247, 1148, 881, 10152, 0, 272, 324, 108, 1188 }, false, 0, 0 },
+    { 1767648000, -564, { 428, 236, 1150, 871, 10154, 0, 322, 313, 108, 1190 }, false, 0, 0 },
+    { 1767648300, -157, { 348, 222, 1147, 886, 10154, 0, 246, 317, 108, 1187 }, false, 0, 0 },
+    { 1767648600, -308, { 301, 173, 1149, 881, 10153, 0, 227, 272, 108, 1189 }, false, 0, 0 },
+    { 1767648900, -570, { 334, 194, 1149, 867, 10151, 0, 242, 279, 108, 1189 }, false, 0, 0 },
+    { 1767649200, -258, { 373, 212, 1148, 868, 10150, 0, 232, 318, 108, 1188 }, false, 0, 0 },
+    { 1767649500, -117, { 354, 204, 1147, 877, 10150, 0, 240, 286, 108, 1187 }, false, 0, 0 },
+    { 1767649800, -438, { 346, 205, 1152, 840, 10151, 0, 215, 284, 108, 1192 }, false, 0, 0 },
+    { 1767650100, -508, { 290, 198, 1149, 875, 10153, 0, 196, 292, 108, 1189 }, false, 0, 0 },
+    { 1767650400, -25, { 360, 230, 1164, 847, 10152, 0, 242, 306, 108, 1204 }, false, 0, 0 },
+    { 1767650700, -515, { 363, 206, 1164, 861, 10152, 0, 235, 294, 108, 1204 }, false, 0, 0 },
+    { 1767651000, -248, { 319, 190, 1168, 836, 10152, 0, 250, 290, 108, 1208 }, false, 0, 0 },
+    { 1767651300, -53, { 288, 181, 1164, 846, 10151, 0, 212, 278, 108, 1204 }, false, 0, 0 },
+    { 1767651600, -534, { 318, 164, 1161, 854, 10151, 0, 177, 274, 108, 1201 }, false, 0, 0 },
+    { 1767651900, -565, { 349, 175, 1165, 830, 10153, 0, 233, 263, 108, 1205 }, false, 0, 0 },
+    { 1767652200, -416, { 302, 175, 1161, 836, 10153, 0, 211, 259, 108, 1201 }, false, 0, 0 },
+    { 1767652500, -152, { 313, 211, 1161, 824, 10154, 0, 228, 287, 108, 1201 }, false, 0, 0 },
+    { 1767652800, -549, { 364, 156, 1166, 823, 10156, 0, 247, 255, 108, 1206 }, false, 0, 0 },
+    { 1767653100, -520, { 242, 168, 1166, 826, 10155, 0, 153, 272, 108, 1206 }, false, 0, 0 },
+    { 1767653400, -493, { 308, 170, 1160, 861, 10155, 0, 218, 272, 108, 1200 }, false, 0, 0 },
+    { 1767653700, -449, { 262, 179, 1164, 850, 10156, 0, 200, 278, 108, 1204 }, false, 0, 0 },
+    { 1767654000, -310, { 254, 226, 1182, 791, 10153, 0, 190, 296, 0, 1222 }, false, 0, 0 },
+    { 1767654300, -539, { 348, 192, 1182, 790, 10152, 0, 202, 277, 0, 1222 }, false, 0, 0 },
+    { 1767654600, -111, { 329, 197, 1184, 788, 10149, 0, 218, 282, 0, 1224 }, false, 0, 0 },
+    { 1767654900, -442, { 277, 188, 1181, 807, 10149, 0, 205, 265, 0, 1221 }, false, 0, 0 },
+    { 1767655200, -138, { 317, 173, 1178, 798, 10149, 0, 242, 272, 0, 1218 }, false, 0, 0 },
+    { 1767655500, -189, { 285, 156, 1176, 813, 10152, 0, 194, 253, 0, 1216 }, false, 0, 0 },
+    { 1767655800, -425, { 305, 152, 1178, 815, 10150, 0, 222, 252, 0, 1218 }, false, 0, 0 },
+    { 1767656100, -63, { 314, 196, 1178, 802, 10148, 0, 226, 294, 0, 1218 }, false, 0, 0 },
+    { 1767656400, -521, { 268, 172, 1179, 793, 10145, 0, 202, 260, 0, 1219 }, false, 0, 0 },
+    { 1767656700, -43, { 255, 191, 1179, 804, 10147, 0, 172, 284, 0, 1219 }, false, 0, 0 },
+    { 1767657000, -534, { 191, 167, 1178, 797, 10148, 0, 138, 269, 0, 1218 }, false, 0, 0 },
+    { 1767657300, -550, { 199, 189, 1180, 815, 10150, 0, 137, 271, 0, 1220 }, false, 0, 0 },
+    { 1767657600, -249, { 250, 156, 1189, 776, 10149, 0, 140, 261, 0, 1229 }, false, 0, 0 },
+    { 1767657900, -281, { 180, 124, 1193, 774, 10149, 0, 138, 227, 0, 1233 }, false, 0, 0 },
+    { 1767658200, -534, { 172, 223, 1197, 730, 10149, 0, 115, 304, 0, 1237 }, false, 0, 0 },
+    { 1767658500, -432, { 185, 177, 1197, 744, 10149, 0, 102, 285, 0, 1237 }, false, 0, 0 },
+    { 1767658800, -205, { 202, 168, 1190, 758, 10152, 72, 141, 267, 6, 1230 }, true, 197, -555 },
+    { 1767659100, -526, { 224, 189, 1194, 772, 10150, 96, 109, 264, 14, 1234 }, true, 266, -422 },
+    { 1767659400, -268, { 173, 173, 1195, 755, 10149, 144, 113, 255, 26, 1235 }, true, 392, -104 },
+    { 1767659700, -266, { 172, 130, 1199, 728, 10148, 144, 117, 234, 38, 1239 }, true, 386, -497 },
+    { 1767660000, -318, { 169, 181, 1197, 763, 10151, 96, 87, 267, 46, 1237 }, true, 258, -79 },
+    { 1767660300, -451, { 177, 181, 1197, 767, 10150, 144, 108, 265, 58, 1237 }, true, 379, -328 },
+    { 1767660600, -236, { 170, 188, 1195, 756, 10151, 96, 120, 277, 66, 1235 }, true, 293, -103 },
+    { 1767660900, -12, { 154, 153, 1195, 760, 10150, 72, 120, 242, 72, 1235 }, true, 197, -277 },
+    { 1767661200, -439, { 175, 197, 1209, 732, 10151, 24, 115, 277, 74, 1249 }, true, 107, -90 },
+    { 1767661500, -135, { 160, 158, 1210, 708, 10152, 144, 103, 264, 86, 1250 }, true, 361, -116 },
+    { 1767661800, -511, { 194, 166, 1212, 706, 10152, 48, 114, 240, 90, 1252 }, true, 169, -120 },
+    { 1767662100, -146, { 175, 148, 1210, 731, 10152, 72, 123, 250, 96, 1250 }, true, 202, -433 },
+    { 1767662400, -435, { 226, 166, 1213, 726, 10152, 144, 160, 243, 108, 1253 }, true, 418, -366 },
+    { 1767662700, -216, { 185, 164, 1211, 721, 10154, 24, 113, 235, 110, 1251 }, true, 99, -30 },
+    { 1767663000, -405, { 204, 173, 1209, 722, 10155, 144, 115, 257, 122, 1249 }, true, 383, -119 },
+    { 1767663300, -357, { 178, 144, 1208, 735, 10154, 24, 146, 254, 124, 1248 }, true, 102, -433 },
+    { 1767663600, -376, { 138, 175, 1205, 728, 10153, 48, 96, 273, 128, 1245 }, true, 128, -572 },
+    { 1767663900, -1, { 257, 169, 1210, 722, 10153, 120, 133, 255, 138, 1250 }, true, 349, -89 },
+    { 1767664200, -182, { 209, 174, 1209, 720, 10153, 120, 158, 265, 148, 1249 }, true, 335, -527 },
+    { 1767664500, -102, { 249, 164, 1209, 708, 10154, 0, 147, 249, 148, 1249 }, false, 0, 0 },
+    { 1767664800, -362, { 232, 155, 1223, 688, 10157, 96, 146, 249, 156, 1263 }, true, 290, -405 },
+    { 1767665100, -501, { 253, 165, 1222, 693, 10159, 96, 170, 252, 164, 1262 }, true, 278, -537 },
+    { 1767665400, -436, { 242, 196, 1224, 687, 10161, 24, 136, 270, 166, 1264 }, true, 109, -428 },
+    { 1767665700, -23, { 175, 172, 1220, 686, 10161, 72, 105, 263, 172, 1260 }, true, 212, -221 },
+    { 1767666000, -260, { 179, 192, 1220, 694, 10160, 0, 135, 274, 172, 1260 }, false, 0, 0 },
+    { 1767666300, -230, { 185, 164, 1223, 692, 10160, 96, 111, 261, 180, 1263 }, true, 258, -506 },
+    { 1767666600, -210, { 196, 163, 1222, 677, 10163, 0, 103, 252, 180, 1262 }, false, 0, 0 },
+    { 1767666900, -93, { 237, 164, 1222, 688, 10165, 72, 123, 249, 186, 1262 }, true, 231, -518 },
+    { 1767667200, -163, { 138, 163, 1224, 676, 10161, 48, 96, 263, 190, 1264 }, true, 127, -90 },
+    { 1767667500, -6, { 215, 178, 1223, 684, 10162, 120, 171, 263, 200, 1263 }, true, 359, -18 },
+    { 1767667800, -259, { 234, 174, 1220, 685, 10161, 96, 172, 270, 208, 1260 }, true, 251, -222 },
+    { 1767668100, -188, { 197, 154, 1223, 698, 10162, 144, 140, 237, 220, 1263 }, true, 366, -60 },
+    { 1767668400, -368, { 199, 204, 1232, 656, 10162, 72, 130, 277, 226, 1272 }, true, 191, -547 },
+    { 1767668700, -420, { 194, 164, 1230, 672, 10164, 96, 139, 254, 234, 1270 }, true, 249, -331 },
+    { 1767669000, -461, { 226, 178, 1232, 662, 10163, 24, 136, 259, 236, 1272 }, true, 75, -60 },
+    { 1767669300, -308, { 170, 168, 1231, 666, 10163, 144, 123, 250, 248, 1271 }, true, 393, -545 },
+    { 1767669600, -559, { 251, 166, 1231, 657, 10162, 48, 180, 273, 252, 1271 }, true, 137, -240 },
+    { 1767669900, -188, { 268, 138, 1232, 683, 10162, 144, 136, 225, 264, 1272 }, true, 366, -258 },
+    { 1767670200, -573, { 291, 176, 1231, 674, 10161, 24, 170, 247, 266, 1271 }, true, 66, -187 },
+    { 1767670500, -358, { 250, 148, 1233, 659, 10164, 0, 190, 247, 266, 1273 }, false, 0, 0 },
+    { 1767670800, -21, { 234, 175, 1232, 665, 10164, 0, 180, 251, 266, 1272 }, false, 0, 0 },
+    { 1767671100, -105, { 236, 145, 1237, 651, 10167, 0, 143, 253, 266, 1277 }, false, 0, 0 },
+    { 1767671400, -184, { 244, 158, 1234, 663, 10169, 0, 183, 249, 266, 1274 }, false, 0, 0 },
+    { 1767671700, -152, { 284, 150, 1226, 700, 10170, 0, 199, 254, 266, 1266 }, false, 0, 0 },
+    { 1767672000, -215, { 274, 175, 1237, 665, 10168, 0, 176, 260, 266, 1277 }, false, 0, 0 },
+    { 1767672300, -274, { 280, 166, 1239, 637, 10168, 0, 168, 245, 266, 1279 }, false, 0, 0 },
+    { 1767672600, -62, { 226, 175, 1241, 641, 10167, 0, 166, 258, 266, 1281 }, false, 0, 0 },
+    { 1767672900, -480, { 243, 179, 1239, 665, 10165, 0, 184, 276, 266, 1279 }, false, 0, 0 },
+    { 1767673200, -592, { 206, 177, 1240, 657, 10164, 0, 152, 267, 266, 1280 }, false, 0, 0 },
+    { 1767673500, -367, { 325, 185, 1239, 662, 10165, 0, 194, 255, 266, 1279 }, false, 0, 0 },
+    { 1767673800, -377, { 246, 211, 1235, 665, 10167, 0, 159, 283, 266, 1275 }, false, 0, 0 },
+    { 1767674100, -117, { 280, 154, 1239, 650, 10168, 0, 164, 247, 266, 1279 }, false, 0, 0 },
+    { 1767674400, -247, { 285, 134, 1234, 689, 10165, 0, 202, 241, 266, 1274 }, false, 0, 0 },
+    { 1767674700, -518, { 257, 213, 1237, 640, 10166, 0, 195, 288, 266, 1277 }, false, 0, 0 },
+    { 1767675000, -537, { 301, 177, 1237, 641, 10167, 0, 202, 255, 266, 1277 }, false, 0, 0 },
+    { 1767675300, -379, { 321, 182, 1235, 683, 10166, 0, 220, 275, 266, 1275 }, false, 0, 0 },
+    { 1767675600, -151, { 258, 184, 1238, 648, 10166, 0, 168, 278, 266, 1278 }, false, 0, 0 },
+    { 1767675900, -323, { 276, 152, 1234, 662, 10168, 0, 183, 250, 266, 1274 }, false, 0, 0 },
+    { 1767676200, -49, { 271, 180, 1241, 640, 10167, 0, 196, 257, 266, 1281 }, false, 0, 0 },
+    { 1767676500, -515, { 255, 177, 1239, 665, 10166, 0, 185, 260, 266, 1279 }, false, 0, 0 },
+    { 1767676800, -344, { 337, 147, 1240, 646, 10168, 0, 243, 255, 266, 1280 }, false, 0, 0 },
+    { 1767677100, -67, { 270, 191, 1240, 647, 10168, 0, 181, 273, 266, 1280 }, false, 0, 0 },
+    { 1767677400, -273, { 328, 173, 1240, 636, 10168, 0, 252, 262, 266, 1280 }, false, 0, 0 },
+    { 1767677700, -163, { 361, 158, 1239, 653, 10164, 0, 198, 251, 266, 1279 }, false, 0, 0 },
+    { 1767678000, -379, { 245, 154, 1241, 644, 10165, 0, 164, 254, 266, 1281 }, false, 0, 0 },
+    { 1767678300, -90, { 260, 153, 1241, 624, 10164, 0, 182, 244, 266, 1281 }, false, 0, 0 },
+    { 1767678600, -316, { 302, 155, 1240, 649, 10166, 0, 184, 264, 266, 1280 }, false, 0, 0 },
+    { 1767678900, -319, { 247, 170, 1240, 654, 10169, 0, 157, 249, 266, 1280 }, false, 0, 0 },
+    { 1767679200, -2, { 291, 176, 1239, 656, 10169, 0, 215, 246, 266, 1279 }, false, 0, 0 },
+    { 1767679500, -591, { 219, 143, 1239, 672, 10169, 0, 157, 238, 266, 1279 }, false, 0, 0 },
+    { 1767679800, -142, { 242, 165, 1240, 633, 10169, 0, 158, 254, 266, 1280 }, false, 0, 0 },
+    { 1767680100, -260, { 294, 154, 1237, 652, 10169, 0, 139, 255, 266, 1277 }, false, 0, 0 },
+    { 1767680400, -540, { 222, 132, 1238, 664, 10170, 0, 123, 234, 266, 1278 }, false, 0, 0 },
+    { 1767680700, -439, { 261, 158, 1236, 674, 10169, 0, 163, 243, 266, 1276 }, false, 0, 0 },
+    { 1767681000, -536, { 192, 173, 1236, 666, 10168, 0, 128, 269, 266, 1276 }, false, 0, 0 },
+    { 1767681300, -273, { 261, 152, 1237, 658, 10169, 0, 172, 255, 266, 1277 }, false, 0, 0 },
+    { 1767681600, -320, { 175, 140, 1237, 678, 10170, 0, 112, 233, 266, 1277 }, false, 0, 0 },
+    { 1767681900, -331, { 170, 155, 1241, 641, 10171, 0, 119, 252, 266, 1281 }, false, 0, 0 },
+    { 1767682200, -406, { 180, 135, 1236, 669, 10172, 0, 120, 244, 266, 1276 }, false, 0, 0 },
+    { 1767682500, -284, { 165, 151, 1237, 652, 10171, 0, 120, 256, 266, 1277 }, false, 0, 0 },
+    { 1767682800, -370, { 196, 166, 1233, 679, 10171, 0, 121, 246, 266, 1273 }, false, 0, 0 },
+    { 1767683100, -287, { 142, 172, 1233, 671, 10170, 0, 93, 260, 266, 1273 }, false, 0, 0 },
+    { 1767683400, -39, { 207, 173, 1231, 657, 10172, 0, 130, 255, 266, 1271 }, false, 0, 0 },
+    { 1767683700, -411, { 217, 159, 1230, 678, 10173, 0, 142, 252, 266, 1270 }, false, 0, 0 },
+    { 1767684000, -211, { 195, 183, 1232, 685, 10174, 0, 151, 254, 266, 1272 }, false, 0, 0 },
+    { 1767684300, -88, { 175, 189, 1230, 680, 10174, 0, 109, 265, 266, 1270 }, false, 0, 0 },
+    { 1767684600, -8, { 170, 163, 1231, 666, 10174, 0, 123, 266, 266, 1271 }, false, 0, 0 },
+    { 1767684900, -289, { 156, 202, 1231, 656, 10175, 0, 101, 286, 266, 1271 }, false, 0, 0 },
+    { 1767685200, -475, { 157, 185, 1232, 673, 10175, 0, 115, 290, 266, 1272 }, false, 0, 0 },
+    { 1767685500, -561, { 161, 162, 1233, 663, 10173, 0, 87, 262, 266, 1273 }, false, 0, 0 },
+    { 1767685800, -591, { 168, 180, 1235, 649, 10175, 0, 98, 263, 266, 1275 }, false, 0, 0 },
+    { 1767686100, -5, { 159, 194, 1231, 666, 10173, 0, 88, 284, 266, 1271 }, false, 0, 0 },
+    { 1767686400, -351, { 152, 184, 1224, 689, 10171, 0, 113, 257, 266, 1264 }, false, 0, 0 },
+    { 1767686700, -201, { 137, 186, 1221, 699, 10170, 0, 96, 274, 266, 1261 }, false, 0, 0 },
+    { 1767687000, -182, { 120, 159, 1225, 683, 10170, 0, 79, 257, 266, 1265 }, false, 0, 0 },
+    { 1767687300, -88, { 138, 186, 1223, 704, 10171, 0, 72, 281, 266, 1263 }, false, 0, 0 },
+    { 1767687600, -497, { 136, 195, 1224, 701, 10171, 0, 85, 279, 266, 1264 }, false, 0, 0 },
+    { 1767687900, -224, { 180, 165, 1222, 692, 10169, 0, 98, 252, 266, 1262 }, false, 0, 0 },
+    { 1767688200, -299, { 202, 183, 1223, 695, 10168, 0, 137, 268, 266, 1263 }, false, 0, 0 },
+    { 1767688500, -244, { 190, 174, 1220, 699, 10168, 0, 141, 262, 266, 1260 }, false, 0, 0 },
+    { 1767688800, -187, { 216, 214, 1223, 709, 10167, 0, 107, 287, 266, 1263 }, false, 0, 0 },
+    { 1767689100, -449, { 261, 147, 1222, 691, 10167, 0, 166, 255, 266, 1262 }, false, 0, 0 },
+    { 1767689400, -181, { 199, 150, 1221, 679, 10167, 0, 132, 256, 266, 1261 }, false, 0, 0 },
+    { 1767689700, -252, { 213, 179, 1221, 700, 10168, 0, 146, 259, 266, 1261 }, false, 0, 0 },
+    { 1767690000, -319, { 153, 150, 1210, 730, 10167, 0, 98, 243, 266, 1250 }, false, 0, 0 },
+    { 1767690300, -310, { 168, 151, 1207, 731, 10167, 0, 111, 257, 266, 1247 }, false, 0, 0 },
+    { 1767690600, -434, { 158, 194, 1209, 743, 10166, 0, 98, 277, 266, 1249 }, false, 0, 0 },
+    { 1767690900, -115, { 175, 192, 1207, 734, 10165, 0, 108, 267, 266, 1247 }, false, 0, 0 },
+    { 1767691200, -302, { 128, 187, 1208, 750, 10166, 0, 98, 286, 266, 1248 }, false, 0, 0 },
+    { 1767691500, -116, { 222, 185, 1210, 731, 10166, 0, 139, 280, 266, 1250 }, false, 0, 0 },
+    { 1767691800, -567, { 195, 190, 1208, 744, 10164, 0, 112, 272, 266, 1248 }, false, 0, 0 },
+    { 1767692100, -414, { 182, 206, 1210, 714, 10165, 0, 91, 277, 266, 1250 }, false, 0, 0 },
+    { 1767692400, -208, { 167, 207, 1211, 723, 10163, 0, 89, 291, 266, 1251 }, false, 0, 0 },
+    { 1767692700, -335, { 105, 162, 1211, 706, 10161, 0, 76, 260, 266, 1251 }, false, 0, 0 },
+    { 1767693000, -347, { 145, 200, 1211, 725, 10161, 0, 71, 280, 266, 1251 }, false, 0, 0 },
+    { 1767693300, -151, { 168, 187, 1210, 726, 10160, 0, 93, 267, 266, 1250 }, false, 0, 0 },
+    { 1767693600, -242, { 179, 199, 1194, 762, 10158, 0, 140, 272, 266, 1234 }, false, 0, 0 },
+    { 1767693900, -68, { 278, 181, 1196, 760, 10158, 0, 140, 287, 266, 1236 }, false, 0, 0 },
+    { 1767694200, -53, { 212, 160, 1192, 755, 10161, 0, 126, 259, 266, 1232 }, false, 0, 0 },
+    { 1767694500, -457, { 151, 194, 1190, 769, 10160, 0, 89, 272, 266, 1230 }, false, 0, 0 },
+    { 1767694800, -195, { 186, 208, 1193, 783, 10161, 0, 119, 278, 266, 1233 }, false, 0, 0 },
+    { 1767695100, -269, { 174, 181, 1198, 768, 10162, 0, 108, 269, 266, 1238 }, false, 0, 0 },
+    { 1767695400, -169, { 136, 208, 1192, 795, 10160, 0, 95, 292, 266, 1232 }, false, 0, 0 },
+    { 1767695700, -485, { 133, 190, 1195, 758, 10162, 0, 61, 280, 266, 1235 }, false, 0, 0 },
+    { 1767696000, -454, { 221, 215, 1197, 743, 10162, 0, 77, 288, 266, 1237 }, false, 0, 0 },
+    { 1767696300, -590, { 110, 208, 1193, 772, 10162, 0, 50, 296, 266, 1233 }, false, 0, 0 },
+    { 1767696600, -414, { 67, 211, 1193, 780, 10162, 0, 50, 292, 266, 1233 }, false, 0, 0 },
+    { 1767696900, -277, { 76, 169, 1196, 760, 10161, 0, 29, 278, 266, 1236 }, false, 0, 0 },
+    { 1767697200, -187, { 39, 185, 1184, 789, 10159, 0, 20, 285, 266, 1224 }, false, 0, 0 },
+    { 1767697500, -584, { 35, 163, 1178, 801, 10159, 0, 3, 273, 266, 1218 }, false, 0, 0 },
+    { 1767697800, -282, { 44, 183, 1181, 800, 10161, 0, 37, 267, 266, 1221 }, false, 0, 0 },
+    { 1767698100, -108, { 99, 192, 1176, 820, 10162, 0, 9, 287, 266, 1216 }, false, 0, 0 },
+    { 1767698400, -244, { 17, 165, 1183, 792, 10164, 0, 6, 267, 266, 1223 }, false, 0, 0 },
+    { 1767698700, -361, { 32, 212, 1181, 806, 10161, 0, 0, 299, 266, 1221 }, false, 0, 0 },
+    { 1767699000, -525, { 55, 212, 1178, 816, 10161, 0, 29, 296, 266, 1218 }, false, 0, 0 },
+    { 1767699300, -549, { 147, 214, 1181, 788, 10162, 0, 62, 312, 266, 1221 }, false, 0, 0 },
+    { 1767699600, -401, { 12, 201, 1176, 821, 10162, 0, 5, 281, 266, 1216 }, false, 0, 0 },
+    { 1767699900, -513, { 84, 191, 1179, 789, 10164, 0, 66, 270, 266, 1219 }, false, 0, 0 },
+    { 1767700200, 0, { 91, 217, 1181, 791, 10164, 0, 46, 311, 266, 1221 }, false, 0, 0 },
+    { 1767700500, -157, { 38, 226, 1184, 799, 10165, 0, 18, 300, 266, 1224 }, false, 0, 0 },
+    { 1767700800, -223, { 155, 211, 1166, 837, 10165, 0, 99, 300, 266, 1206 }, false, 0, 0 },
+    { 1767701100, -88, { 168, 228, 1162, 856, 10167, 0, 89, 301, 266, 1202 }, false, 0, 0 },
+    { 1767701400, -319, { 108, 227, 1166, 843, 10165, 0, 60, 298, 266, 1206 }, false, 0, 0 },
+    { 1767701700, -451, { 50, 237, 1163, 847, 10166, 0, 31, 317, 266, 1203 }, false, 0, 0 },
+    { 1767702000, -595, { 26, 226, 1165, 822, 10169, 0, 9, 309, 266, 1205 }, false, 0, 0 },
+    { 1767702300, -294, { 32, 232, 1166, 820, 10168, 0, 0, 312, 266, 1206 }, false, 0, 0 },
+    { 1767702600, -482, { 17, 235, 1167, 842, 10168, 0, 8, 316, 266, 1207 }, false, 0, 0 },
+    { 1767702900, -212, { 68, 233, 1163, 839, 10166, 0, 0, 315, 266, 1203 }, false, 0, 0 },
+    { 1767703200, -89, { 59, 238, 1168, 839, 10164, 0, 0, 319, 266, 1208 }, false, 0, 0 },
+    { 1767703500, -427, { 16, 174, 1161, 844, 10163, 0, 0, 267, 266, 1201 }, false, 0, 0 },
+    { 1767703800, -136, { 10, 218, 1165, 828, 10163, 0, 0, 304, 266, 1205 }, false, 0, 0 },
+    { 1767704100, -476, { 28, 219, 1164, 835, 10162, 0, 0, 307, 266, 1204 }, false, 0, 0 },
+    { 1767704400, -180, { 36, 206, 1149, 883, 10161, 0, 34, 303, 266, 1189 }, false, 0, 0 },
+    { 1767704700, -1, { 68, 230, 1148, 872, 10163, 0, 0, 316, 266, 1188 }, false, 0, 0 },
+    { 1767705000, -265, { 21, 230, 1151, 855, 10161, 0, 9, 307, 266, 1191 }, false, 0, 0 },
+    { 1767705300, -559, { 49, 202, 1151, 877, 10161, 0, 0, 309, 266, 1191 }, false, 0, 0 },
+    { 1767705600, -97, { 36, 215, 1147, 899, 10163, 0, 25, 294, 266, 1187 }, false, 0, 0 },
+    { 1767705900, -320, { 8, 238, 1150, 862, 10164, 0, 0, 316, 266, 1190 }, false, 0, 0 },
+    { 1767706200, -39, { 69, 250, 1152, 864, 10164, 0, 29, 322, 266, 1192 }, false, 0, 0 },
+    { 1767706500, -553, { 68, 227, 1145, 903, 10166, 0, 34, 326, 266, 1185 }, false, 0, 0 },
+    { 1767706800, -19, { 99, 206, 1150, 852, 10167, 0, 9, 308, 266, 1190 }, false, 0, 0 },
+    { 1767707100, -524, { 41, 238, 1146, 897, 10165, 0, 30, 313, 266, 1186 }, false, 0, 0 },
+    { 1767707400, -375, { 44, 252, 1150, 880, 10167, 0, 4, 328, 266, 1190 }, false, 0, 0 },
+    { 1767707700, -62, { 43, 206, 1149, 855, 10168, 0, 11, 312, 266, 1189 }, false, 0, 0 },
+    { 1767708000, -150, { 69, 213, 1136, 906, 10167, 0, 24, 317, 266, 1176 }, false, 0, 0 },
+    { 1767708300, -94, { 76, 185, 1139, 905, 10166, 0, 50, 294, 266, 1179 }, false, 0, 0 },
+    { 1767708600, -510, { 85, 216, 1138, 905, 10167, 0, 65, 295, 266, 1178 }, false, 0, 0 },
+    { 1767708900, -163, { 130, 246, 1140, 903, 10165, 0, 73, 316, 266, 1180 }, false, 0, 0 },
+    { 1767709200, -589, { 188, 229, 1134, 912, 10161, 0, 91, 339, 266, 1174 }, false, 0, 0 },
+    { 1767709500, -517, { 98, 251, 1137, 923, 10163, 0, 64, 333, 266, 1177 }, false, 0, 0 },
+    { 1767709800, -443, { 134, 225, 1135, 905, 10163, 0, 93, 329, 266, 1175 }, false, 0, 0 },
+    { 1767710100, -151, { 165, 237, 1134, 931, 10163, 0, 111, 310, 266, 1174 }, false, 0, 0 },
+    { 1767710400, -493, { 103, 243, 1141, 903, 10162, 0, 60, 321, 266, 1181 }, false, 0, 0 },
+    { 1767710700, -512, { 116, 250, 1137, 902, 10161, 0, 84, 330, 266, 1177 }, false, 0, 0 },
+    { 1767711000, -214, { 70, 220, 1139, 904, 10159, 0, 44, 298, 266, 1179 }, false, 0, 0 },
+    { 1767711300, -211, { 119, 251, 1136, 908, 10159, 0, 55, 333, 266, 1176 }, false, 0, 0 },
+    { 1767711600, -88, { 175, 238, 1128, 927, 10159, 0, 104, 334, 266, 1168 }, false, 0, 0 },
+    { 1767711900, -1, { 185, 224, 1126, 924, 10158, 0, 130, 308, 266, 1166 }, false, 0, 0 },
+    { 1767712200, -206, { 209, 235, 1126, 934, 10158, 0, 110, 322, 266, 1166 }, false, 0, 0 },
+    { 1767712500, -263, { 203, 240, 1127, 930, 10156, 0, 127, 337, 266, 1167 }, false, 0, 0 },
+    { 1767712800, -256, { 199, 251, 1131, 913, 10156, 0, 144, 327, 266, 1171 }, false, 0, 0 },
+    { 1767713100, -337, { 191, 233, 1128, 910, 10159, 0, 114, 328, 266, 1168 }, false, 0, 0 },
+    { 1767713400, -136, { 223, 221, 1126, 922, 10161, 0, 169, 311, 266, 1166 }, false, 0, 0 },
+    { 1767713700, -148, { 267, 245, 1124, 927, 10161, 0, 155, 331, 266, 1164 }, false, 0, 0 },
+    { 1767714000, -258, { 210, 251, 1125, 942, 10160, 0, 150, 335, 266, 1165 }, false, 0, 0 },
+    { 1767714300, -500, { 266, 205, 1126, 925, 10160, 0, 177, 311, 266, 1166 }, false, 0, 0 },
+    { 1767714600, -507, { 290, 242, 1127, 936, 10159, 0, 145, 342, 266, 1167 }, false, 0, 0 },
+    { 1767714900, -334, { 277, 251, 1126, 908, 10160, 0, 196, 325, 266, 1166 }, false, 0, 0 },
+    { 1767715200, -242, { 293, 257, 1126, 912, 10161, 0, 183, 332, 266, 1166 }, false, 0, 0 },
+    { 1767715500, -498, { 246, 219, 1124, 934, 10161, 0, 170, 322, 266, 1164 }, false, 0, 0 },
+    { 1767715800, -402, { 268, 247, 1122, 945, 10160, 0, 213, 318, 266, 1162 }, false, 0, 0 },
+    { 1767716100, -226, { 203, 215, 1118, 954, 10160, 0, 152, 325, 266, 1158 }, false, 0, 0 },
+    { 1767716400, -38, { 227, 234, 1124, 947, 10160, 0, 155, 326, 266, 1164 }, false, 0, 0 },
+    { 1767716700, -206, { 222, 271, 1122, 957, 10163, 0, 165, 353, 266, 1162 }, false, 0, 0 },
+    { 1767717000, -495, { 311, 230, 1121, 945, 10167, 0, 199, 331, 266, 1161 }, false, 0, 0 },
+    { 1767717300, -480, { 234, 237, 1121, 940, 10166, 0, 166, 320, 266, 1161 }, false, 0, 0 },
+    { 1767717600, 0, { 221, 219, 1121, 932, 10167, 0, 165, 301, 266, 1161 }, false, 0, 0 },
+    { 1767717900, -574, { 259, 253, 1122, 954, 10165, 0, 201, 330, 266, 1162 }, false, 0, 0 },
+    { 1767718200, -541, { 274, 222, 1121, 935, 10164, 0, 158, 314, 266, 1161 }, false, 0, 0 },
+    { 1767718500, -85, { 266, 244, 1124, 930, 10163, 0, 184, 337, 266, 1164 }, false, 0, 0 },
+    { 1767718800, -384, { 308, 262, 1116, 973, 10163, 0, 207, 347, 266, 1156 }, false, 0, 0 },
+    { 1767719100, -393, { 265, 233, 1119, 950, 10164, 0, 157, 324, 266, 1159 }, false, 0, 0 },
+    { 1767719400, -257, { 266, 231, 1120, 937, 10162, 0, 188, 335, 266, 1160 }, false, 0, 0 },
+    { 1767719700, -256, { 268, 272, 1118, 956, 10162, 0, 174, 355, 266, 1158 }, false, 0, 0 },
+    { 1767720000, -308, { 293, 279, 1121, 946, 10163, 0, 174, 369, 266, 1161 }, false, 0, 0 },
+    { 1767720300, -166, { 241, 236, 1121, 941, 10164, 0, 173, 337, 266, 1161 }, false, 0, 0 },
+    { 1767720600, -369, { 275, 238, 1120, 953, 10167, 0, 196, 326, 266, 1160 }, false, 0, 0 },
+    { 1767720900, -238, { 337, 239, 1116, 961, 10167, 0, 196, 330, 266, 1156 }, false, 0, 0 },
+    { 1767721200, -562, { 295, 214, 1119, 964, 10169, 0, 193, 309, 266, 1159 }, false, 0, 0 },
+    { 1767721500, -252, { 316, 275, 1116, 954, 10167, 0, 207, 345, 266, 1156 }, false, 0, 0 },
+    { 1767721800, -115, { 278, 257, 1120, 951, 10165, 0, 185, 340, 266, 1160 }, false, 0, 0 },
+    { 1767722100, -321, { 366, 235, 1118, 960, 10164, 0, 201, 342, 266, 1158 }, false, 0, 0 },
+    { 1767722400, -501, { 314, 239, 1122, 946, 10162, 0, 211, 330, 266, 1162 }, false, 0, 0 },
+    { 1767722700, -70, { 308, 235, 1121, 955, 10162, 0, 209, 319, 266, 1161 }, false, 0, 0 },
+    { 1767723000, -355, { 315, 244, 1122, 946, 10162, 0, 242, 352, 266, 1162 }, false, 0, 0 },
+    { 1767723300, -86, { 322, 262, 1119, 935, 10161, 0, 229, 332, 266, 1159 }, false, 0, 0 },
+    { 1767723600, -339, { 414, 228, 1119, 951, 10160, 0, 251, 322, 266, 1159 }, false, 0, 0 },
+    { 1767723900, -433, { 322, 272, 1123, 941, 10160, 0, 232, 351, 266, 1163 }, false, 0, 0 },
+    { 1767724200, -527, { 355, 263, 1119, 944, 10161, 0, 265, 362, 266, 1159 }, false, 0, 0 },
+    { 1767724500, -172, { 346, 236, 1122, 953, 10159, 0, 230, 323, 266, 1162 }, false, 0, 0 },
+    { 1767724800, -420, { 391, 228, 1120, 951, 10158, 0, 292, 325, 266, 1160 }, false, 0, 0 },
+    { 1767725100, -222, { 355, 239, 1123, 937, 10159, 0, 268, 343, 266, 1163 }, false, 0, 0 },
+    { 1767725400, -599, { 370, 218, 1120, 942, 10158, 0, 247, 304, 266, 1160 }, false, 0, 0 },
+    { 1767725700, -267, { 291, 233, 1124, 957, 10162, 0, 202, 312, 266, 1164 }, false, 0, 0 },
+    { 1767726000, -239, { 270, 250, 1128, 942, 10161, 0, 205, 338, 266, 1168 }, false, 0, 0 },
+    { 1767726300, -306, { 303, 277, 1128, 945, 10161, 0, 223, 357, 266, 1168 }, false, 0, 0 },
+    { 1767726600, -222, { 331, 242, 1127, 930, 10160, 0, 169, 326, 266, 1167 }, false, 0, 0 },
+    { 1767726900, -527, { 275, 260, 1128, 934, 10158, 0, 168, 331, 266, 1168 }, false, 0, 0 },
+    { 1767727200, -559, { 280, 237, 1128, 927, 10159, 0, 179, 337, 266, 1168 }, false, 0, 0 },
+    { 1767727500, -356, { 261, 236, 1129, 923, 10160, 0, 189, 321, 266, 1169 }, false, 0, 0 },
+    { 1767727800, -6, { 223, 195, 1126, 933, 10158, 0, 144, 293, 266, 1166 }, false, 0, 0 },
+    { 1767728100, -300, { 267, 257, 1127, 926, 10159, 0, 197, 342, 266, 1167 }, false, 0, 0 },
+    { 1767728400, -504, { 264, 245, 1129, 933, 10160, 0, 178, 317, 266, 1169 }, false, 0, 0 },
+    { 1767728700, -107, { 331, 243, 1127, 929, 10161, 0, 235, 324, 266, 1167 }, false, 0, 0 },
+    { 1767729000, -137, { 254, 259, 1130, 900, 10160, 0, 183, 338, 266, 1170 }, false, 0, 0 },
+    { 1767729300, -289, { 283, 203, 1128, 921, 10160, 0, 178, 302, 266, 1168 }, false, 0, 0 },
+    { 1767729600, -245, { 333, 224, 1136, 889, 10162, 0, 192, 332, 266, 1176 }, false, 0, 0 },
+    { 1767729900, -532, { 224, 225, 1136, 911, 10164, 0, 161, 309, 266, 1176 }, false, 0, 0 },
+    { 1767730200, -376, { 277, 220, 1135, 912, 10165, 0, 199, 320, 266, 1175 }, false, 0, 0 },
+    { 1767730500, -457, { 336, 216, 1136, 906, 10166, 0, 236, 308, 266, 1176 }, false, 0, 0 },
+    { 1767730800, -177, { 392, 214, 1133, 902, 10165, 0, 243, 310, 266, 1173 }, false, 0, 0 },
+    { 1767731100, -254, { 300, 237, 1137, 912, 10164, 0, 213, 310, 266, 1177 }, false, 0, 0 },
+    { 1767731400, -265, { 325, 221, 1136, 906, 10167, 0, 239, 319, 266, 1176 }, false, 0, 0 },
+    { 1767731700, -99, { 300, 221, 1137, 887, 10165, 0, 230, 321, 266, 1177 }, false, 0, 0 },
+    { 1767732000, -265, { 254, 232, 1137, 903, 10162, 0, 180, 335, 266, 1177 }, false, 0, 0 },
+    { 1767732300, -363, { 238, 231, 1136, 921, 10164, 0, 167, 319, 266, 1176 }, false, 0, 0 },
+    { 1767732600, -362, { 248, 256, 1140, 906, 10160, 0, 177, 328, 266, 1180 }, false, 0, 0 },
+    { 1767732900, -489, { 317, 244, 1136, 896, 10160, 0, 206, 328, 266, 1176 }, false, 0, 0 },
+    { 1767733200, -30, { 269, 238, 1147, 873, 10157, 0, 195, 328, 266, 1187 }, false, 0, 0 },
+    { 1767733500, -141, { 270, 252, 1150, 888, 10156, 0, 189, 336, 266, 1190 }, false, 0, 0 },
+    { 1767733800, -61, { 221, 205, 1151, 862, 10154, 0, 156, 309, 266, 1191 }, false, 0, 0 },
+    { 1767734100, -392, { 201, 193, 1152, 865, 10154, 0, 145, 300, 266, 1192 }, false, 0, 0 },
+    { 1767734400, -331, { 200, 264, 1148, 872, 10152, 0, 136, 335, 266, 1188 }, false, 0, 0 },
+    { 1767734700, -1, { 227, 238, 1151, 871, 10153, 0, 157, 315, 266, 1191 }, false, 0, 0 },
+    { 1767735000, -491, { 169, 238, 1155, 863, 10153, 0, 124, 317, 266, 1195 }, false, 0, 0 },
+    { 1767735300, -155, { 237, 205, 1146, 898, 10155, 0, 155, 307, 266, 1186 }, false, 0, 0 },
+    { 1767735600, -572, { 257, 227, 1148, 875, 10155, 0, 155, 325, 266, 1188 }, false, 0, 0 },
+    { 1767735900, -338, { 120, 214, 1149, 881, 10155, 0, 55, 323, 266, 1189 }, false, 0, 0 },
+    { 1767736200, -148, { 77, 225, 1150, 865, 10153, 0, 49, 316, 266, 1190 }, false, 0, 0 },
+    { 1767736500, -82, { 160, 215, 1149, 889, 10152, 0, 111, 303, 266, 1189 }, false, 0, 0 },
+    { 1767736800, -450, { 125, 220, 1164, 870, 10151, 0, 49, 314, 266, 1204 }, false, 0, 0 },
+    { 1767737100, -246, { 167, 216, 1166, 819, 10151, 0, 78, 314, 266, 1206 }, false, 0, 0 },
+    { 1767737400, -182, { 144, 201, 1165, 841, 10152, 0, 88, 300, 266, 1205 }, false, 0, 0 },
+    { 1767737700, -260, { 154, 203, 1162, 842, 10153, 0, 67, 301, 266, 1202 }, false, 0, 0 },
+    { 1767738000, -196, { 130, 186, 1167, 841, 10152, 0, 71, 283, 266, 1207 }, false, 0, 0 },
+    { 1767738300, -39, { 142, 232, 1165, 834, 10152, 0, 57, 320, 266, 1205 }, false, 0, 0 },
+    { 1767738600, -574, { 89, 260, 1164, 844, 10154, 0, 44, 351, 266, 1204 }, false, 0, 0 },
+    { 1767738900, -374, { 61, 224, 1164, 859, 10154, 0, 36, 295, 266, 1204 }, false, 0, 0 },
+    { 1767739200, -574, { 15, 207, 1165, 842, 10155, 0, 0, 308, 266, 1205 }, false, 0, 0 },
+    { 1767739500, -47, { 108, 244, 1166, 800, 10153, 0, 75, 331, 266, 1206 }, false, 0, 0 },
+    { 1767739800, -209, { 148, 197, 1160, 852, 10153, 0, 68, 302, 266, 1200 }, false, 0, 0 },
+    { 1767740100, -132, { 19, 238, 1164, 836, 10153, 0, 3, 319, 266, 1204 }, false, 0, 0 },
+    { 1767740400, -537, { 128, 190, 1181, 806, 10154, 0, 22, 291, 0, 1221 }, false, 0, 0 },
+    { 1767740700, -462, { 59, 223, 1176, 790, 10153, 0, 42, 295, 0, 1216 }, false, 0, 0 },
+    { 1767741000, -68, { 63, 229, 1179, 807, 10151, 0, 47, 311, 0, 1219 }, false, 0, 0 },
+    { 1767741300, -451, { 122, 250, 1182, 798, 10151, 0, 79, 333, 0, 1222 }, false, 0, 0 },
+    { 1767741600, -167, { 119, 212, 1179, 798, 10150, 0, 82, 301, 0, 1219 }, false, 0, 0 },
+    { 1767741900, -52, { 175, 194, 1184, 786, 10150, 0, 112, 302, 0, 1224 }, false, 0, 0 },
+    { 1767742200, -7, { 166, 211, 1180, 812, 10149, 0, 91, 294, 0, 1220 }, false, 0, 0 },
+    { 1767742500, -237, { 128, 203, 1179, 784, 10150, 0, 64, 278, 0, 1219 }, false, 0, 0 },
+    { 1767742800, -50, { 47, 200, 1178, 794, 10150, 0, 3, 303, 0, 1218 }, false, 0, 0 },
+    { 1767743100, -307, { 33, 241, 1184, 787, 10155, 0, 12, 324, 0, 1224 }, false, 0, 0 },
+    { 1767743400, -561, { 129, 226, 1180, 805, 10154, 0, 21, 303, 0, 1220 }, false, 0, 0 },
+    { 1767743700, -172, { 1, 208, 1176, 799, 10155, 0, 0, 301, 0, 1216 }, false, 0, 0 },
+    { 1767744000, -24, { 37, 159, 1196, 770, 10156, 0, 0, 253, 0, 1236 }, false, 0, 0 },
+    { 1767744300, -292, { 54, 189, 1195, 766, 10157, 0, 0, 286, 0, 1235 }, false, 0, 0 },
+    { 1767744600, -453, { 94, 153, 1195, 775, 10158, 0, 22, 263, 0, 1235 }, false, 0, 0 },
+    { 1767744900, -470, { 45, 222, 1198, 766, 10159, 0, 0, 301, 0, 1238 }, false, 0, 0 },
+    { 1767745200, -200, { 16, 243, 1198, 742, 10159, 0, 0, 319, 0, 1238 }, false, 0, 0 },
+    { 1767745500, -363, { 25, 174, 1196, 742, 10159, 0, 0, 282, 0, 1236 }, false, 0, 0 },
+    { 1767745800, -67, { 93, 175, 1196, 752, 10159, 0, 44, 259, 0, 1236 }, false, 0, 0 },
+    { 1767746100, -237, { 18, 206, 1199, 767, 10158, 0, 0, 284, 0, 1239 }, false, 0, 0 },
+    { 1767746400, -551, { 66, 173, 1197, 765, 10155, 0, 30, 271, 0, 1237 }, false, 0, 0 },
+    { 1767746700, -353, { 13, 167, 1196, 777, 10157, 0, 0, 269, 0, 1236 }, false, 0, 0 },
+    { 1767747000, -195, { 80, 194, 1199, 746, 10157, 0, 17, 300, 0, 1239 }, false, 0, 0 },
+    { 1767747300, -401, { 59, 207, 1196, 757, 10156, 0, 8, 294, 0, 1236 }, false, 0, 0 },
+    { 1767747600, -45, { 57, 170, 1210, 725, 10153, 0, 26, 259, 0, 1250 }, false, 0, 0 },
+    { 1767747900, -357, { 97, 212, 1209, 735, 10154, 0, 20, 302, 0, 1249 }, false, 0, 0 },
+    { 1767748200, -422, { 49, 198, 1211, 726, 10155, 24, 36, 274, 2, 1251 }, true, 93, -143 },
+    { 1767748500, -393, { 52, 149, 1207, 720, 10156, 24, 33, 249, 4, 1247 }, true, 64, -155 },
+    { 1767748800, -227, { 111, 172, 1206, 734, 10156, 96, 53, 262, 12, 1246 }, true, 279, -95 },
+    { 1767749100, -488, { 57, 173, 1207, 713, 10156, 120, 32, 272, 22, 1247 }, true, 321, -599 },
+    { 1767749400, -409, { 135, 180, 1208, 718, 10154, 96, 112, 277, 30, 1248 }, true, 268, -384 },
+    { 1767749700, -200, { 101, 183, 1207, 733, 10153, 72, 81, 254, 36, 1247 }, true, 224, -376 },
+    { 1767750000, -436, { 108, 151, 1213, 709, 10154, 120, 74, 257, 46, 1253 }, true, 301, -460 },
+    { 1767750300, -268, { 79, 200, 1211, 713, 10151, 120, 53, 277, 56, 1251 }, true, 305, -169 },
+    { 1767750600, -98, { 167, 172, 1208, 724, 10149, 144, 116, 260, 68, 1248 }, true, 399, -436 },
+    { 1767750900, -323, { 145, 206, 1212, 704, 10151, 0, 93, 276, 68, 1252 }, false, 0, 0 },
+    { 1767751200, -229, { 81, 145, 1220, 695, 10150, 144, 46, 250, 80, 1260 }, true, 379, -379 },
+    { 1767751500, -401, { 151, 178, 1221, 683, 10150, 144, 71, 272, 92, 1261 }, true, 388, -40 },
+    { 1767751800, -504, { 219, 167, 1225, 693, 10148, 120, 135, 254, 102, 1265 }, true, 343, -530 },
+    { 1767752100, -410, { 197, 182, 1220, 710, 10148, 24, 138, 260, 104, 1260 }, true, 105, -273 },
+    { 1767752400, -407, { 156, 165, 1220, 690, 10151, 120, 115, 257, 114, 1260 }, true, 345, -583 },
+    { 1767752700, -237, { 219, 174, 1224, 668, 10152, 144, 111, 258, 126, 1264 }, true, 412, -309 },
+    { 1767753000, -219, { 150, 164, 1221, 696, 10150, 96, 98, 254, 134, 1261 }, true, 276, -330 },
+    { 1767753300, -51, { 153, 136, 1222, 683, 10148, 72, 65, 245, 140, 1262 }, true, 206, -40 },
+    { 1767753600, -24, { 182, 215, 1221, 703, 10148, 24, 111, 286, 142, 1261 }, true, 62, -19 },
+    { 1767753900, -214, { 170, 208, 1222, 699, 10149, 0, 89, 280, 142, 1262 }, false, 0, 0 },
+    { 1767754200, -245, { 130, 159, 1221, 701, 10147, 72, 66, 240, 148, 1261 }, true, 196, -299 },
+    { 1767754500, -526, { 168, 162, 1223, 688, 10146, 96, 127, 269, 156, 1263 }, true, 260, -295 },
+    { 1767754800, -557, { 215, 173, 1228, 683, 10146, 72, 159, 248, 162, 1268 }, true, 224, -334 },
+    { 1767755100, -292, { 236, 180, 1231, 668, 10147, 144, 147, 258, 174, 1271 }, true, 404, -195 },
+    { 1767755400, -425, { 236, 205, 1233, 681, 10150, 72, 152, 289, 180, 1273 }, true, 237, -78 },
+    { 1767755700, -166, { 197, 194, 1231, 682, 10150, 0, 141, 264, 180, 1271 }, false, 0, 0 },
+    { 1767756000, -330, { 299, 161, 1235, 672, 10149, 0, 177, 259, 180, 1275 }, false, 0, 0 },
+    { 1767756300, -281, { 239, 166, 1236, 663, 10151, 0, 133, 270, 180, 1276 }, false, 0, 0 },
+    { 1767756600, -458, { 195, 159, 1235, 654, 10151, 0, 139, 240, 180, 1275 }, false, 0, 0 },
+    { 1767756900, -320, { 194, 164, 1229, 669, 10151, 0, 125, 268, 180, 1269 }, false, 0, 0 },
+    { 1767757200, -302, { 225, 136, 1230, 676, 10149, 0, 173, 240, 180, 1270 }, false, 0, 0 },
+    { 1767757500, -160, { 248, 169, 1232, 666, 10150, 0, 172, 269, 180, 1272 }, false, 0, 0 },
+    { 1767757800, -573, { 271, 149, 1231, 665, 10152, 0, 169, 251, 180, 1271 }, false, 0, 0 },
+    { 1767758100, -112, { 276, 140, 1231, 647, 10154, 0, 219, 242, 180, 1271 }, false, 0, 0 },
+    { 1767758400, -580, { 302, 179, 1237, 660, 10155, 0, 195, 266, 180, 1277 }, false, 0, 0 },
+    { 1767758700, -413, { 295, 177, 1237, 665, 10157, 0, 219, 279, 180, 1277 }, false, 0, 0 },
+    { 1767759000, -319, { 267, 152, 1237, 663, 10155, 0, 205, 242, 180, 1277 }, false, 0, 0 },
+    { 1767759300, -546, { 331, 175, 1241, 648, 10156, 0, 213, 267, 180, 1281 }, false, 0, 0 },
+    { 1767759600, -113, { 251, 203, 1242, 652, 10158, 0, 187, 277, 180, 1282 }, false, 0, 0 },
+    { 1767759900, -533, { 281, 137, 1238, 628, 10159, 0, 207, 239, 180, 1278 }, false, 0, 0 },
+    { 1767760200, -331, { 283, 175, 1235, 678, 10158, 0, 188, 256, 180, 1275 }, false, 0, 0 },
+    { 1767760500, -68, { 234, 151, 1236, 656, 10156, 0, 169, 258, 180, 1276 }, false, 0, 0 },
+    { 1767760800, -246, { 201, 139, 1234, 669, 10154, 0, 125, 245, 180, 1274 }, false, 0, 0 },
+    { 1767761100, -417, { 236, 170, 1238, 649, 10155, 0, 166, 258, 180, 1278 }, false, 0, 0 },
+    { 1767761400, -87, { 215, 189, 1235, 658, 10156, 0, 132, 281, 180, 1275 }, false, 0, 0 },
+    { 1767761700, -431, { 239, 144, 1238, 663, 10156, 0, 138, 228, 180, 1278 }, false, 0, 0 },
+    { 1767762000, -561, { 213, 163, 1241, 636, 10155, 0, 143, 258, 180, 1281 }, false, 0, 0 },
+    { 1767762300, -39, { 248, 175, 1243, 639, 10153, 0, 163, 247, 180, 1283 }, false, 0, 0 },
+    { 1767762600, -343, { 253, 143, 1240, 659, 10152, 0, 169, 247, 180, 1280 }, false, 0, 0 },
+    { 1767762900, -298, { 209, 150, 1240, 661, 10153, 0, 136, 250, 180, 1280 }, false, 0, 0 },
+    { 1767763200, -512, { 192, 142, 1239, 639, 10154, 0, 140, 244, 180, 1279 }, false, 0, 0 },
+    { 1767763500, -468, { 170, 157, 1238, 643, 10154, 0, 108, 253, 180, 1278 }, false, 0, 0 },
+    { 1767763800, -22, { 201, 147, 1236, 650, 10153, 0, 104, 238, 180, 1276 }, false, 0, 0 },
+    { 1767764100, -70, { 183, 138, 1242, 635, 10152, 24, 115, 239, 182, 1282 }, true, 76, -299 },
+    { 1767764400, -595, { 119, 143, 1238, 648, 10154, 120, 31, 243, 192, 1278 }, true, 351, -431 },
+    { 1767764700, -343, { 104, 145, 1242, 648, 10157, 120, 50, 246, 202, 1282 }, true, 351, -252 },
+    { 1767765000, -35, { 167, 157, 1239, 650, 10158, 24, 80, 236, 204, 1279 }, true, 74, -61 },
+    { 1767765300, -169, { 152, 163, 1238, 660, 10159, 96, 47, 256, 212, 1278 }, true, 287, -476 },
+    { 1767765600, -500, { 80, 175, 1238, 651, 10159, 144, 49, 246, 224, 1278 }, true, 376, -317 },
+    { 1767765900, -429, { 139, 147, 1239, 656, 10156, 48, 73, 249, 228, 1279 }, true, 160, -565 },
+    { 1767766200, -460, { 152, 140, 1240, 650, 10156, 144, 70, 233, 240, 1280 }, true, 380, -590 },
+    { 1767766500, -212, { 136, 183, 1239, 667, 10157, 24, 93, 253, 242, 1279 }, true, 88, -501 },
+    { 1767766800, -195, { 99, 171, 1239, 656, 10159, 48, 67, 257, 246, 1279 }, true, 179, -371 },
+    { 1767767100, -190, { 124, 172, 1236, 656, 10157, 96, 63, 256, 254, 1276 }, true, 275, -331 },
+    { 1767767400, -483, { 108, 146, 1235, 665, 10155, 120, 55, 229, 264, 1275 }, true, 329, -527 },
+    { 1767767700, -91, { 156, 164, 1238, 652, 10156, 48, 80, 240, 268, 1278 }, true, 136, -584 },
+    { 1767768000, -337, { 75, 189, 1242, 654, 10156, 144, 44, 267, 280, 1282 }, true, 364, -135 },
+    { 1767768300, -476, { 117, 184, 1237, 663, 10159, 144, 84, 263, 292, 1277 }, true, 405, -583 },
+    { 1767768600, -426, { 100, 160, 1239, 644, 10158, 24, 51, 262, 294, 1279 }, true, 92, -465 },
+    { 1767768900, -48, { 131, 159, 1240, 658, 10158, 120, 90, 232, 304, 1280 }, true, 339, -378 },
+    { 1767769200, -259, { 83, 145, 1231, 671, 10161, 0, 53, 235, 304, 1271 }, false, 0, 0 },
+    { 1767769500, -591, { 98, 170, 1232, 670, 10160, 72, 62, 272, 310, 1272 }, true, 230, -373 },
+    { 1767769800, -162, { 129, 193, 1232, 661, 10161, 144, 54, 275, 322, 1272 }, true, 385, -530 },
+    { 1767770100, -361, { 58, 151, 1230, 686, 10160, 48, 41, 248, 326, 1270 }, true, 168, -237 },
+    { 1767770400, -177, { 17, 156, 1233, 665, 10157, 72, 0, 243, 332, 1273 }, true, 218, -331 },
+    { 1767770700, -536, { 39, 171, 1232, 673, 10158, 144, 22, 255, 344, 1272 }, true, 403, -271 },
+    { 1767771000, -374, { 110, 132, 1228, 682, 10157, 48, 63, 233, 348, 1268 }, true, 139, -9 },
+    { 1767771300, -380, { 100, 141, 1233, 678, 10156, 0, 31, 246, 348, 1273 }, false, 0, 0 },
+    { 1767771600, -22, { 77, 166, 1230, 668, 10156, 96, 20, 244, 356, 1270 }, true, 266, -22 },
+    { 1767771900, -365, { 104, 152, 1235, 655, 10156, 48, 12, 251, 360, 1275 }, true, 132, -368 },
+    { 1767772200, -69, { 23, 148, 1232, 665, 10154, 72, 0, 237, 366, 1272 }, true, 194, -50 },
+    { 1767772500, -442, { 27, 131, 1229, 694, 10152, 120, 0, 227, 376, 1269 }, true, 318, -170 },
+    { 1767772800, -263, { 14, 139, 1221, 690, 10153, 120, 0, 243, 386, 1261 }, true, 343, -339 },
+    { 1767773100, -125, { 61, 142, 1221, 693, 10153, 48, 0, 249, 390, 1261 }, true, 161, -160 },
+    { 1767773400, -556, { 30, 177, 1222, 698, 10152, 24, 0, 247, 392, 1262 }, true, 63, -465 },
+    { 1767773700, -331, { 56, 170, 1224, 684, 10153, 72, 29, 246, 398, 1264 }, true, 195, -588 },
+    { 1767774000, -582, { 122, 154, 1220, 715, 10154, 0, 78, 252, 398, 1260 }, false, 0, 0 },
+    { 1767774300, -307, { 53, 142, 1220, 703, 10155, 0, 29, 240, 398, 1260 }, false, 0, 0 },
+    { 1767774600, -486, { 38, 188, 1225, 663, 10154, 0, 17, 284, 398, 1265 }, false, 0, 0 },
+    { 1767774900, -329, { 2, 152, 1220, 699, 10158, 0, 0, 260, 398, 1260 }, false, 0, 0 },
+    { 1767775200, -292, { 49, 173, 1217, 696, 10162, 0, 10, 278, 398, 1257 }, false, 0, 0 },
+    { 1767775500, -113, { 45, 175, 1222, 696, 10161, 0, 19, 264, 398, 1262 }, false, 0, 0 },
+    { 1767775800, -24, { 118, 169, 1222, 680, 10161, 0, 57, 266, 398, 1262 }, false, 0, 0 },
+    { 1767776100, -100, { 91, 157, 1225, 694, 10157, 0, 66, 245, 398, 1265 }, false, 0, 0 },
+    { 1767776400, -166, { 133, 154, 1210, 726, 10157, 0, 68, 254, 398, 1250 }, false, 0, 0 },
+    { 1767776700, -473, { 202, 156, 1210, 716, 10155, 0, 99, 228, 398, 1250 }, false, 0, 0 },
+    { 1767777000, -242, { 146, 177, 1206, 724, 10157, 0, 97, 251, 398, 1246 }, false, 0, 0 },
+    { 1767777300, -32, { 176, 154, 1209, 720, 10161, 0, 90, 250, 398, 1249 }, false, 0, 0 },
+    { 1767777600, -470, { 159, 162, 1214, 724, 10160, 0, 114, 256, 398, 1254 }, false, 0, 0 },
+    { 1767777900, -188, { 203, 155, 1212, 720, 10161, 0, 129, 238, 398, 1252 }, false, 0, 0 },
+    { 1767778200, -106, { 220, 184, 1207, 736, 10161, 0, 146, 258, 398, 1247 }, false, 0, 0 },
+    { 1767778500, -220, { 218, 154, 1207, 744, 10161, 0, 158, 261, 398, 1247 }, false, 0, 0 },
+    { 1767778800, -50, { 262, 170, 1209, 723, 10163, 0, 189, 248, 398, 1249 }, false, 0, 0 },
+    { 1767779100, -9, { 220, 172, 1211, 713, 10164, 0, 146, 282, 398, 1251 }, false, 0, 0 },
+    { 1767779400, -320, { 283, 175, 1211, 711, 10163, 96, 167, 263, 406, 1251 }, true, 257, -573 },
+    { 1767779700, -552, { 318, 199, 1209, 708, 10165, 120, 213, 278, 416, 1249 }, true, 353, -354 },
+    { 1767780000, -5, { 317, 129, 1194, 759, 10164, 120, 179, 226, 426, 1234 }, true, 319, -68 },
+    { 1767780300, -251, { 306, 198, 1191, 777, 10166, 72, 153, 270, 432, 1231 }, true, 232, -59 },
+    { 1767780600, -522, { 223, 185, 1195, 744, 10166, 120, 135, 267, 442, 1235 }, true, 352, -409 },
+    { 1767780900, -484, { 293, 169, 1198, 762, 10165, 48, 146, 258, 446, 1238 }, true, 122, -123 },
+    { 1767781200, -571, { 198, 149, 1194, 773, 10167, 48, 124, 254, 450, 1234 }, true, 148, -384 },
+    { 1767781500, -488, { 227, 183, 1194, 759, 10166, 48, 135, 259, 454, 1234 }, true, 153, -192 },
+    { 1767781800, -461, { 211, 167, 1197, 756, 10165, 48, 147, 261, 458, 1237 }, true, 163, -57 },
+    { 1767782100, -66, { 234, 162, 1195, 763, 10163, 120, 101, 269, 468, 1235 }, true, 340, -543 },
+    { 1767782400, -65, { 134, 159, 1197, 770, 10165, 0, 95, 248, 468, 1237 }, false, 0, 0 },
+    { 1767782700, -47, { 148, 204, 1196, 742, 10164, 120, 93, 292, 478, 1236 }, true, 350, -194 },
+    { 1767783000, -18, { 165, 127, 1195, 744, 10164, 0, 122, 235, 478, 1235 }, false, 0, 0 },
+    { 1767783300, -316, { 130, 142, 1196, 765, 10162, 24, 93, 252, 480, 1236 }, true, 89, -479 },
+    { 1767783600, -428, { 125, 175, 1178, 805, 10161, 144, 90, 282, 492, 1218 }, true, 419, -561 },
+    { 1767783900, -124, { 123, 192, 1183, 791, 10159, 72, 92, 269, 498, 1223 }, true, 196, -460 },
+    { 1767784200, -589, { 196, 213, 1179, 778, 10159, 48, 145, 283, 502, 1219 }, true, 129, -290 },
+    { 1767784500, -284, { 110, 189, 1181, 788, 10158, 0, 76, 262, 502, 1221 }, false, 0, 0 },
+    { 1767784800, -336, { 185, 175, 1179, 810, 10158, 48, 72, 280, 506, 1219 }, true, 125, -378 },
+    { 1767785100, -86, { 130, 208, 1181, 783, 10159, 144, 65, 278, 518, 1221 }, true, 378, -51 },
+    { 1767785400, -442, { 120, 176, 1180, 802, 10157, 48, 61, 264, 522, 1220 }, true, 140, -233 },
+    { 1767785700, -273, { 101, 182, 1182, 783, 10156, 24, 70, 284, 524, 1222 }, true, 100, -434 },
+    { 1767786000, -171, { 121, 189, 1179, 803, 10156, 96, 77, 262, 532, 1219 }, true, 256, -470 },
+    { 1767786300, -559, { 158, 162, 1180, 799, 10154, 120, 128, 269, 542, 1220 }, true, 300, -184 },
+    { 1767786600, -259, { 156, 211, 1182, 809, 10153, 96, 117, 300, 550, 1222 }, true, 268, -316 },
+    { 1767786900, -189, { 173, 200, 1180, 803, 10151, 0, 124, 272, 550, 1220 }, false, 0, 0 },
+    { 1767787200, -592, { 184, 210, 1165, 806, 10151, 96, 111, 280, 558, 1205 }, true, 260, -546 },
+    { 1767787500, -182, { 177, 171, 1164, 829, 10149, 0, 116, 261, 558, 1204 }, false, 0, 0 },
+    { 1767787800, -258, { 171, 183, 1164, 840, 10148, 0, 102, 292, 558, 1204 }, false, 0, 0 },
+    { 1767788100, -108, { 186, 153, 1165, 850, 10148, 0, 144, 263, 558, 1205 }, false, 0, 0 },
+    { 1767788400, -227, { 179, 181, 1166, 834, 10147, 0, 86, 288, 558, 1206 }, false, 0, 0 },
+    { 1767788700, -205, { 231, 180, 1162, 842, 10148, 0, 104, 269, 558, 1202 }, false, 0, 0 },
+    { 1767789000, -346, { 149, 206, 1164, 827, 10148, 0, 96, 289, 558, 1204 }, false, 0, 0 },
+    { 1767789300, -567, { 156, 217, 1161, 845, 10146, 0, 80, 293, 558, 1201 }, false, 0, 0 },
+    { 1767789600, -453, { 168, 218, 1165, 846, 10146, 0, 118, 297, 558, 1205 }, false, 0, 0 },
+    { 1767789900, -600, { 148, 205, 1159, 860, 10145, 0, 86, 276, 558, 1199 }, false, 0, 0 },
+    { 1767790200, -275, { 207, 214, 1165, 829, 10147, 0, 137, 284, 558, 1205 }, false, 0, 0 },
+    { 1767790500, -314, { 175, 192, 1166, 832, 10149, 0, 120, 267, 558, 1206 }, false, 0, 0 },
+    { 1767790800, -124, { 167, 205, 1151, 865, 10150, 0, 128, 284, 558, 1191 }, false, 0, 0 },
+    { 1767791100, -344, { 146, 238, 1148, 872, 10148, 0, 109, 312, 558, 1188 }, false, 0, 0 },
+    { 1767791400, -330, { 219, 180, 1148, 883, 10146, 0, 127, 282, 558, 1188 }, false, 0, 0 },
+    { 1767791700, -324, { 243, 176, 1151, 890, 10148, 0, 169, 270, 558, 1191 }, false, 0, 0 },
+    { 1767792000, -161, { 173, 218, 1149, 876, 10148, 0, 106, 291, 558, 1189 }, false, 0, 0 },
+    { 1767792300, -10, { 206, 202, 1152, 856, 10150, 0, 118, 288, 558, 1192 }, false, 0, 0 },
+    { 1767792600, -555, { 225, 173, 1153, 875, 10148, 0, 144, 276, 558, 1193 }, false, 0, 0 },
+    { 1767792900, -337, { 200, 171, 1149, 868, 10149, 0, 129, 281, 558, 1189 }, false, 0, 0 },
+    { 1767793200, -430, { 181, 181, 1152, 873, 10149, 0, 131, 275, 558, 1192 }, false, 0, 0 },
+    { 1767793500, -323, { 225, 216, 1147, 881, 10149, 0, 115, 309, 558, 1187 }, false, 0, 0 },
+    { 1767793800, -512, { 245, 222, 1149, 872, 10150, 0, 177, 296, 558, 1189 }, false, 0, 0 },
+    { 1767794100, -442, { 172, 229, 1146, 883, 10149, 0, 126, 319, 558, 1186 }, false, 0, 0 },
+    { 1767794400, -570, { 212, 184, 1139, 900, 10146, 0, 115, 294, 558, 1179 }, false, 0, 0 },
+    { 1767794700, -217, { 197, 200, 1138, 906, 10149, 0, 151, 298, 558, 1178 }, false, 0, 0 },
+    { 1767795000, -121, { 173, 243, 1139, 925, 10147, 0, 98, 318, 558, 1179 }, false, 0, 0 },
+    { 1767795300, -278, { 120, 188, 1137, 904, 10147, 0, 87, 290, 558, 1177 }, false, 0, 0 },
+    { 1767795600, -463, { 125, 240, 1137, 910, 10150, 0, 65, 311, 558, 1177 }, false, 0, 0 },
+    { 1767795900, -457, { 216, 233, 1139, 886, 10148, 0, 155, 309, 558, 1179 }, false, 0, 0 },
+    { 1767796200, -127, { 161, 207, 1141, 895, 10148, 0, 68, 298, 558, 1181 }, false, 0, 0 },
+    { 1767796500, -197, { 223, 218, 1138, 893, 10147, 0, 117, 313, 558, 1178 }, false, 0, 0 },
+    { 1767796800, -305, { 123, 203, 1140, 895, 10143, 0, 82, 304, 558, 1180 }, false, 0, 0 },
+    { 1767797100, -208, { 212, 229, 1137, 928, 10145, 0, 72, 321, 558, 1177 }, false, 0, 0 },
+    { 1767797400, -379, { 143, 219, 1140, 895, 10145, 0, 43, 304, 558, 1180 }, false, 0, 0 },
+    { 1767797700, -438, { 141, 210, 1135, 897, 10146, 0, 54, 297, 558, 1175 }, false, 0, 0 },
+    { 1767798000, -69, { 142, 224, 1128, 933, 10148, 0, 74, 317, 558, 1168 }, false, 0, 0 },
+    { 1767798300, -302, { 79, 203, 1129, 929, 10147, 0, 54, 310, 558, 1169 }, false, 0, 0 },
+    { 1767798600, -433, { 92, 192, 1126, 929, 10147, 0, 71, 281, 558, 1166 }, false, 0, 0 },
+    { 1767798900, -400, { 67, 196, 1127, 938, 10146, 0, 49, 302, 558, 1167 }, false, 0, 0 },
+    { 1767799200, -342, { 139, 210, 1128, 924, 10145, 0, 77, 306, 558, 1168 }, false, 0, 0 },
+    { 1767799500, -298, { 61, 242, 1129, 916, 10146, 0, 24, 338, 558, 1169 }, false, 0, 0 },
+    { 1767799800, -470, { 17, 236, 1127, 916, 10149, 0, 0, 325, 558, 1167 }, false, 0, 0 },
+    { 1767800100, -354, { 7, 223, 1129, 934, 10151, 0, 1, 315, 558, 1169 }, false, 0, 0 },
+    { 1767800400, -114, { 27, 230, 1127, 914, 10152, 0, 22, 302, 558, 1167 }, false, 0, 0 },
+    { 1767800700, -413, { 57, 225, 1127, 945, 10155, 0, 19, 329, 558, 1167 }, false, 0, 0 },
+    { 1767801000, -557, { 55, 213, 1127, 926, 10153, 0, 40, 309, 558, 1167 }, false, 0, 0 },
+    { 1767801300, -105, { 60, 227, 1128, 932, 10151, 0, 40, 311, 558, 1168 }, false, 0, 0 },
+    { 1767801600, -52, { 176, 216, 1121, 954, 10153, 0, 77, 297, 558, 1161 }, false, 0, 0 },
+    { 1767801900, -519, { 128, 233, 1120, 965, 10156, 0, 49, 323, 558, 1160 }, false, 0, 0 },
+    { 1767802200, -36, { 126, 251, 1124, 932, 10156, 0, 69, 325, 558, 1164 }, false, 0, 0 },
+    { 1767802500, -581, { 146, 207, 1124, 932, 10157, 0, 36, 312, 558, 1164 }, false, 0, 0 },
+    { 1767802800, -526, { 75, 216, 1121, 932, 10153, 0, 54, 319, 558, 1161 }, false, 0, 0 },
+    { 1767803100, -505, { 114, 222, 1120, 951, 10151, 0, 70, 319, 558, 1160 }, false, 0, 0 },
+    { 1767803400, -101, { 96, 220, 1123, 938, 10155, 0, 66, 325, 558, 1163 }, false, 0, 0 },
+    { 1767803700, -476, { 56, 201, 1120, 979, 10156, 0, 30, 303, 558, 1160 }, false, 0, 0 },
+    { 1767804000, -491, { 100, 229, 1124, 909, 10155, 0, 64, 314, 558, 1164 }, false, 0, 0 },
+    { 1767804300, -482, { 108, 225, 1120, 953, 10156, 0, 81, 323, 558, 1160 }, false, 0, 0 },
+    { 1767804600, -241, { 166, 231, 1123, 947, 10160, 0, 127, 305, 558, 1163 }, false, 0, 0 },
+    { 1767804900, -326, { 186, 209, 1121, 945, 10158, 0, 130, 295, 558, 1161 }, false, 0, 0 },
+    { 1767805200, -195, { 185, 230, 1121, 945, 10162, 0, 99, 319, 558, 1161 }, false, 0, 0 },
+    { 1767805500, -137, { 157, 202, 1113, 965, 10158, 0, 80, 300, 558, 1153 }, false, 0, 0 },
+    { 1767805800, -281, { 150, 199, 1117, 962, 10154, 0, 87, 305, 558, 1157 }, false, 0, 0 },
+    { 1767806100, -100, { 153, 252, 1118, 936, 10153, 0, 95, 324, 558, 1158 }, false, 0, 0 },
+    { 1767806400, -431, { 141, 226, 1119, 966, 10154, 0, 98, 314, 558, 1159 }, false, 0, 0 },
+    { 1767806700, -179, { 203, 195, 1118, 953, 10154, 0, 101, 297, 558, 1158 }, false, 0, 0 },
+    { 1767807000, -374, { 164, 219, 1121, 954, 10155, 0, 107, 298, 558, 1161 }, false, 0, 0 },
+    { 1767807300, -351, { 88, 222, 1121, 951, 10155, 0, 57, 327, 558, 1161 }, false, 0, 0 },
+    { 1767807600, -27, { 186, 240, 1120, 938, 10154, 0, 148, 344, 558, 1160 }, false, 0, 0 },
+    { 1767807900, -132, { 173, 253, 1119, 944, 10154, 0, 119, 328, 558, 1159 }, false, 0, 0 },
+    { 1767808200, -9, { 224, 240, 1125, 918, 10154, 0, 148, 312, 558, 1165 }, false, 0, 0 },
+    { 1767808500, -107, { 133, 257, 1117, 956, 10152, 0, 100, 346, 558, 1157 }, false, 0, 0 },
+    { 1767808800, -424, { 139, 225, 1120, 942, 10151, 0, 86, 315, 558, 1160 }, false, 0, 0 },
+    { 1767809100, -65, { 221, 252, 1121, 938, 10149, 0, 132, 336, 558, 1161 }, false, 0, 0 },
+    { 1767809400, -318, { 201, 219, 1119, 959, 10149, 0, 116, 320, 558, 1159 }, false, 0, 0 },
+    { 1767809700, -424, { 167, 272, 1119, 956, 10151, 0, 113, 347, 558, 1159 }, false, 0, 0 },
+    { 1767810000, -468, { 123, 218, 1119, 951, 10151, 0, 92, 325, 558, 1159 }, false, 0, 0 },
+    { 1767810300, -365, { 198, 278, 1124, 948, 10147, 0, 135, 352, 558, 1164 }, false, 0, 0 },
+    { 1767810600, -141, { 148, 225, 1124, 923, 10146, 0, 100, 327, 558, 1164 }, false, 0, 0 },
+    { 1767810900, -444, { 214, 221, 1122, 945, 10146, 0, 138, 326, 558, 1162 }, false, 0, 0 },
+    { 1767811200, -133, { 174, 246, 1123, 943, 10149, 0, 138, 330, 558, 1163 }, false, 0, 0 },
+    { 1767811500, -563, { 220, 257, 1121, 917, 10151, 0, 121, 331, 558, 1161 }, false, 0, 0 },
+    { 1767811800, -21, { 170, 264, 1121, 939, 10152, 0, 100, 339, 558, 1161 }, false, 0, 0 },
+    { 1767812100, -309, { 156, 243, 1118, 947, 10153, 0, 105, 325, 558, 1158 }, false, 0, 0 },
+    { 1767812400, -384, { 118, 252, 1127, 919, 10151, 0, 86, 334, 558, 1167 }, false, 0, 0 },
+    { 1767812700, -142, { 138, 251, 1133, 923, 10150, 0, 73, 347, 558, 1173 }, false, 0, 0 },
+    { 1767813000, -450, { 159, 249, 1127, 918, 10149, 0, 114, 319, 558, 1167 }, false, 0, 0 },
+    { 1767813300, -540, { 144, 257, 1128, 925, 10147, 0, 83, 338, 558, 1168 }, false, 0, 0 },
+    { 1767813600, -488, { 158, 231, 1128, 932, 10146, 0, 112, 324, 558, 1168 }, false, 0, 0 },
+    { 1767813900, -218, { 99, 193, 1128, 928, 10148, 0, 57, 294, 558, 1168 }, false, 0, 0 },
+    { 1767814200, -365, { 199, 242, 1129, 933, 10147, 0, 99, 343, 558, 1169 }, false, 0, 0 },
+    { 1767814500, -238, { 115, 242, 1126, 933, 10146, 0, 73, 326, 558, 1166 }, false, 0, 0 },
+    { 1767814800, -88, { 144, 229, 1129, 930, 10147, 0, 71, 333, 558, 1169 }, false, 0, 0 },
+    { 1767815100, -171, { 138, 256, 1129, 907, 10145, 0, 65, 326, 558, 1169 }, false, 0, 0 },
+    { 1767815400, -582, { 160, 226, 1126, 935, 10146, 0, 82, 330, 558, 1166 }, false, 0, 0 },
+    { 1767815700, -223, { 137, 218, 1129, 923, 10143, 0, 101, 321, 558, 1169 }, false, 0, 0 },
+    { 1767816000, -458, { 216, 224, 1135, 921, 10146, 0, 116, 331, 558, 1175 }, false, 0, 0 },
+    { 1767816300, -388, { 197, 183, 1137, 928, 10147, 0, 156, 293, 558, 1177 }, false, 0, 0 },
+    { 1767816600, -443, { 226, 261, 1135, 917, 10148, 0, 120, 367, 558, 1175 }, false, 0, 0 },
+    { 1767816900, -158, { 233, 229, 1132, 911, 10147, 0, 143, 328, 558, 1172 }, false, 0, 0 },
+    { 1767817200, -538, { 168, 241, 1137, 914, 10146, 0, 82, 335, 558, 1177 }, false, 0, 0 },
+    { 1767817500, -6, { 109, 229, 1134, 910, 10147, 0, 65, 317, 558, 1174 }, false, 0, 0 },
+    { 1767817800, -127, { 266, 197, 1136, 916, 10147, 0, 165, 296, 558, 1176 }, false, 0, 0 },
+    { 1767818100, -352, { 209, 251, 1136, 902, 10148, 0, 160, 327, 558, 1176 }, false, 0, 0 },
+    { 1767818400, -114, { 207, 218, 1137, 914, 10151, 0, 134, 308, 558, 1177 }, false, 0, 0 },
+    { 1767818700, -520, { 202, 249, 1138, 898, 10152, 0, 138, 333, 558, 1178 }, false, 0, 0 },
+    { 1767819000, -69, { 160, 266, 1134, 922, 10151, 0, 101, 340, 558, 1174 }, false, 0, 0 },
+    { 1767819300, -186, { 251, 229, 1136, 914, 10151, 0, 175, 337, 558, 1176 }, false, 0, 0 },
+    { 1767819600, -288, { 141, 258, 1145, 887, 10149, 0, 96, 329, 558, 1185 }, false, 0, 0 },
+    { 1767819900, -170, { 237, 271, 1150, 868, 10151, 0, 172, 345, 558, 1190 }, false, 0, 0 },
+    { 1767820200, -523, { 221, 246, 1152, 876, 10150, 0, 96, 318, 558, 1192 }, false, 0, 0 },
+    { 1767820500, -133, { 197, 233, 1148, 880, 10148, 0, 138, 319, 558, 1188 }, false, 0, 0 },
+    { 1767820800, -449, { 206, 229, 1147, 895, 10148, 0, 125, 333, 558, 1187 }, false, 0, 0 },
+    { 1767821100, -509, { 213, 219, 1147, 859, 10148, 0, 123, 307, 558, 1187 }, false, 0, 0 },
+    { 1767821400, -106, { 179, 227, 1149, 871, 10148, 0, 99, 335, 558, 1189 }, false, 0, 0 },
+    { 1767821700, -415, { 215, 239, 1151, 869, 10147, 0, 121, 324, 558, 1191 }, false, 0, 0 },
+    { 1767822000, -175, { 176, 218, 1148, 891, 10147, 0, 136, 324, 558, 1188 }, false, 0, 0 },
+    { 1767822300, -336, { 118, 259, 1149, 855, 10144, 0, 72, 355, 558, 1189 }, false, 0, 0 },
+    { 1767822600, -143, { 179, 259, 1149, 868, 10146, 0, 110, 335, 558, 1189 }, false, 0, 0 },
+    { 1767822900, -457, { 127, 218, 1149, 880, 10145, 0, 88, 322, 558, 1189 }, false, 0, 0 },
+    { 1767823200, -445, { 158, 245, 1162, 817, 10144, 0, 79, 328, 558, 1202 }, false, 0, 0 },
+    { 1767823500, -203, { 158, 212, 1166, 836, 10145, 0, 92, 295, 558, 1206 }, false, 0, 0 },
+    { 1767823800, -560, { 170, 253, 1162, 829, 10144, 0, 93, 334, 558, 1202 }, false, 0, 0 },
+    { 1767824100, -408, { 113, 250, 1164, 851, 10146, 0, 78, 349, 558, 1204 }, false, 0, 0 },
+    { 1767824400, -7, { 130, 215, 1163, 844, 10146, 0, 58, 314, 558, 1203 }, false, 0, 0 },
+    { 1767824700, -524, { 120, 268, 1163, 828, 10145, 0, 81, 341, 558, 1203 }, false, 0, 0 },
+    { 1767825000, -545, { 150, 218, 1165, 829, 10146, 0, 91, 309, 558, 1205 }, false, 0, 0 },
+    { 1767825300, -454, { 151, 238, 1165, 831, 10147, 0, 107, 313, 558, 1205 }, false, 0, 0 },
+    { 1767825600, -402, { 90, 264, 1168, 830, 10147, 0, 44, 334, 558, 1208 }, false, 0, 0 },
+};
+
+#define ObsTraceLength  (sizeof(obsTrace) / sizeof(obsTrace[0]))
+
+// Port 1 report for a trace row; returns its length
+inline uint8_t traceReport(const ObsTraceRow &r, obsPayload &p)
+{
+    memset(&p, 0, sizeof(p));
+    memcpy(&p.obsReport, r.obs, sizeof(obsSet));
+    p.stamp.frameBase = r.frameBase;
+    p.stamp.gustOffset = r.gustOffset;
+    if (!r.rain)
+        return sizeof(obsSet) + sizeof(obsStamp);
+    p.rainExt.rainPeakX10 = r.rainPeakX10;
+    p.rainExt.firstTipOffset = r.firstTipOffset;
+    return sizeof(obsSet) + sizeof(obsStamp) + sizeof(obsRainExt);
+}
+
+#endif
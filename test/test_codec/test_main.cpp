@@ -0,0 +1,78 @@
+/*
+ * test_main.cpp - ObsCodec replayed over a report trace
+ *
+ * pio test -e native -v    (-v shows the measured frame sizes)
+ * The trace is test/native/ObsTrace.h, from tools/traces (tools/obs_trace.py).
+ * Reports are coded FRAME_REPORTS to a frame, as TxPlanner batches them.
+ */
+
+#include <stdio.h>
+#include <unity.h>
+#include <ObsCodec.h>
+#include <ObsTrace.h>
+
+#define FRAME_REPORTS  4
+
+// Code reports [first, first + n) as one frame; returns its length
+static uint8_t codeFrame(uint16_t first, uint8_t n, uint8_t *frame)
+{
+	ObsEncoder enc;
+	uint8_t len = 0;
+	enc.startFrame();
+	for (uint8_t i = 0; i < n; i++) {
+		obsPayload p;
+		uint8_t reportLen = traceReport(obsTrace[first + i], p);
+		len += enc.encode(p.readAccess(), reportLen, &frame[len]);
+	}
+	return len;
+}
+
+// Every other frame is lost: each one received must still decode in full
+void test_frames_decode_on_their_own(void)
+{
+	ObsDecoder dec;
+	for (uint16_t first = 0; first + FRAME_REPORTS <= ObsTraceLength; first += 2 * FRAME_REPORTS) {
+		uint8_t frame[FRAME_REPORTS * CODEC_RECORD_MAX];
+		uint8_t frameLen = codeFrame(first, FRAME_REPORTS, frame);
+		uint8_t pos = 0;
+		dec.startFrame();
+		for (uint8_t i = 0; i < FRAME_REPORTS; i++) {
+			obsPayload p, out;
+			uint8_t len = traceReport(obsTrace[first + i], p);
+			uint8_t used, outLen;
+			TEST_ASSERT_EQUAL(Codec_Report, dec.decode(frame + pos, frameLen - pos, used, out, outLen));
+			pos += used;
+			TEST_ASSERT_EQUAL(len, outLen);
+			TEST_ASSERT_EQUAL_MEMORY(p.readAccess(), out.readAccess(), len);
+		}
+		TEST_ASSERT_EQUAL(frameLen, pos);
+	}
+}
+
+// Against a port 2 batch of the same reports (each preceded by its length byte)
+void test_frames_smaller_than_batches(void)
+{
+	unsigned long coded = 0, raw = 0, frames = 0;
+	for (uint16_t first = 0; first + FRAME_REPORTS <= ObsTraceLength; first += FRAME_REPORTS) {
+		uint8_t frame[FRAME_REPORTS * CODEC_RECORD_MAX];
+		coded += codeFrame(first, FRAME_REPORTS, frame);
+		for (uint8_t i = 0; i < FRAME_REPORTS; i++) {
+			obsPayload p;
+			raw += 1 + traceReport(obsTrace[first + i], p);
+		}
+		frames++;
+	}
+	char msg[96];
+	snprintf(msg, sizeof(msg), "%lu frames of %u reports: coded %.1f bytes, port 2 batch %.1f",
+			frames, FRAME_REPORTS, (double)coded / frames, (double)raw / frames);
+	TEST_MESSAGE(msg);
+	TEST_ASSERT_LESS_THAN(raw, coded);
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_frames_decode_on_their_own);
+	RUN_TEST(test_frames_smaller_than_batches);
+	return UNITY_END();
+}
@@ -0,0 +1,82 @@
+/*
+ * test_main.cpp - LocalClock across the 2026 AEST/AEDT changes
+ *
+ * pio test -e native
+ * Expected epochs are from the Australia/Sydney zone (zoneinfo).
+ */
+
+#include <unity.h>
+#include <LocalClock.h>
+
+#define EOD_HOUR 9
+
+TimeChangeRule auEDST = {"AEDT", First, Sun, Oct, 2, 660};
+TimeChangeRule auESTD = {"AEST", First, Sun, Apr, 3, 600};	// 3am AEDT
+
+// 2026 (UTC)
+#define AEDT_ENDS       1775318400L		// 04 Apr 16:00 = 05 Apr 03:00 AEDT -> 02:00 AEST
+#define AEDT_STARTS     1791043200L		// 03 Oct 16:00 = 04 Oct 02:00 AEST -> 03:00 AEDT
+#define AEDT_ENDS_2027  1806768000L		// 03 Apr 2027 16:00
+#define HOUR            3600L
+
+void test_offset_before_and_after_april_change(void)
+{
+	Timezone tz(auEDST, auESTD);
+	LocalClock clock(tz);
+	TEST_ASSERT_EQUAL(AEDT_ENDS - 1 + 11 * HOUR, clock.toLocal(AEDT_ENDS - 1));
+	TEST_ASSERT_EQUAL(39600L, clock.offset());
+	TEST_ASSERT_EQUAL(AEDT_ENDS, clock.nextChange());
+	TEST_ASSERT_EQUAL(AEDT_ENDS + 10 * HOUR, clock.toLocal(AEDT_ENDS));
+	TEST_ASSERT_EQUAL(36000L, clock.offset());
+	TEST_ASSERT_EQUAL(AEDT_STARTS, clock.nextChange());
+}
+
+void test_offset_before_and_after_october_change(void)
+{
+	Timezone tz(auEDST, auESTD);
+	LocalClock clock(tz);
+	TEST_ASSERT_EQUAL(AEDT_STARTS - 1 + 10 * HOUR, clock.toLocal(AEDT_STARTS - 1));
+	TEST_ASSERT_EQUAL(AEDT_STARTS, clock.nextChange());
+	TEST_ASSERT_EQUAL(AEDT_STARTS + 11 * HOUR, clock.toLocal(AEDT_STARTS));
+	TEST_ASSERT_EQUAL(39600L, clock.offset());
+	TEST_ASSERT_EQUAL(AEDT_ENDS_2027, clock.nextChange());
+}
+
+void test_clock_stepped_back_across_a_change(void)
+{
+	Timezone tz(auEDST, auESTD);
+	LocalClock clock(tz);
+	clock.toLocal(AEDT_STARTS + HOUR);
+	TEST_ASSERT_EQUAL(AEDT_STARTS - HOUR + 10 * HOUR, clock.toLocal(AEDT_STARTS - HOUR));
+	TEST_ASSERT_EQUAL(AEDT_STARTS, clock.nextChange());
+}
+
+// 9am on the changeover day, looked for from the evening before (the change falls between)
+void test_rollover_on_april_changeover_day(void)
+{
+	Timezone tz(auEDST, auESTD);
+	LocalClock clock(tz);
+	TEST_ASSERT_EQUAL(1775343600L, clock.nextLocalHour(AEDT_ENDS - 6 * HOUR, EOD_HOUR));	// 05 Apr 09:00 AEST
+	TEST_ASSERT_EQUAL(1775343600L, clock.nextLocalHour(AEDT_ENDS + HOUR, EOD_HOUR));
+	TEST_ASSERT_EQUAL(1775430000L, clock.nextLocalHour(1775343600L, EOD_HOUR));			// then 06 Apr
+}
+
+void test_rollover_on_october_changeover_day(void)
+{
+	Timezone tz(auEDST, auESTD);
+	LocalClock clock(tz);
+	TEST_ASSERT_EQUAL(1791064800L, clock.nextLocalHour(AEDT_STARTS - 6 * HOUR, EOD_HOUR));	// 04 Oct 09:00 AEDT
+	TEST_ASSERT_EQUAL(1791064800L, clock.nextLocalHour(AEDT_STARTS + HOUR, EOD_HOUR));
+	TEST_ASSERT_EQUAL(1791151200L, clock.nextLocalHour(1791064800L, EOD_HOUR));			// then 05 Oct
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_offset_before_and_after_april_change);
+	RUN_TEST(test_offset_before_and_after_october_change);
+	RUN_TEST(test_clock_stepped_back_across_a_change);
+	RUN_TEST(test_rollover_on_april_changeover_day);
+	RUN_TEST(test_rollover_on_october_changeover_day);
+	return UNITY_END();
+}
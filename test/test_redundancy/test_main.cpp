@@ -0,0 +1,159 @@
+/*
+ * test_main.cpp - loss recovery with echoed reports (TxPlanner redundancy)
+ *
+ * pio test -e native -v    (-v shows the recovery figures)
+ * The trace (test/native/ObsTrace.h) goes through TxPlanner on FPort 4 at DR5
+ * with LOSS_PERCENT of frames lost - the same frames for every setting - and,
+ * as the baseline, as plain port 1 reports (TxVariant_Full, no redundancy).
+ * Decoded reports are checked against the trace.
+ */
+
+#include <stdio.h>
+#include <unity.h>
+#include <TxPlanner.h>
+#include <ObsTrace.h>
+
+#define LOSS_PERCENT  20
+
+static uint16_t recovered[REDUNDANCY_MAX + 1];
+static unsigned long frameBytes[REDUNDANCY_MAX + 1];
+static uint16_t plainRecovered;
+
+// Repeatable loss pattern, independent of the host's rand()
+static bool lost(uint32_t &seed)
+{
+	seed = seed * 1103515245UL + 12345;
+	return ((seed >> 16) % 100) < LOSS_PERCENT;
+}
+
+// Check a decoded report against the trace & mark it received
+static void receive(const obsPayload &out, uint8_t outLen, bool *got)
+{
+	obsPayload ref;
+	uint16_t n = (out.stamp.frameBase - obsTrace[0].frameBase) / 300;
+	TEST_ASSERT_TRUE(n < ObsTraceLength);
+	TEST_ASSERT_EQUAL(traceReport(obsTrace[n], ref), outLen);
+	TEST_ASSERT_EQUAL_MEMORY(ref.readAccess(), out.readAccess(), outLen);
+	got[n] = true;
+}
+
+static void replay(uint8_t redundancy)
+{
+	TxPlanner planner(sizeof(obsSet));
+	planner.setInterval(300);
+	planner.setVariant(TxVariant_Delta);
+	planner.setRedundancy(redundancy);
+	ObsDecoder dec;
+	static bool got[ObsTraceLength];
+	memset(got, 0, sizeof(got));
+	uint32_t seed = 1;
+	uint16_t frames = 0;
+
+	for (uint16_t i = 0; i < ObsTraceLength; i++) {
+		obsPayload p;
+		uint8_t len = traceReport(obsTrace[i], p);
+		time_t t = obsTrace[i].frameBase;
+		planner.enqueue(p.readAccess(), len, t);
+		if (!planner.plan(t, 5))
+			continue;
+		frames++;
+		frameBytes[redundancy] += planner.frameLength();
+		if (!lost(seed)) {
+			const uint8_t *frame = planner.frame();
+			uint8_t pos = 0;
+			dec.startFrame();
+			while (pos < planner.frameLength()) {
+				obsPayload out;
+				uint8_t outLen, used;
+				uint8_t st = dec.decode(frame + pos, planner.frameLength() - pos, used, out, outLen);
+				if (!used)
+					break;
+				pos += used;
+				if (st == Codec_Fail)
+					continue;
+				receive(out, outLen, got);
+			}
+		}
+		planner.sent(t);
+	}
+	for (uint16_t i = 0; i < ObsTraceLength; i++)
+		recovered[redundancy] += got[i];
+	frameBytes[redundancy] /= frames;
+
+	char msg[80];
+	snprintf(msg, sizeof(msg), "redundancy %u: %u/%u reports recovered, frames average %lu bytes",
+			redundancy, recovered[redundancy], (unsigned)ObsTraceLength, frameBytes[redundancy]);
+	TEST_MESSAGE(msg);
+}
+
+// Port 1 reports (port 2 if the budget ever batches them), under the same loss
+void test_plain_reports(void)
+{
+	TxPlanner planner(sizeof(obsSet));
+	planner.setInterval(300);
+	planner.setVariant(TxVariant_Full);
+	static bool got[ObsTraceLength];
+	memset(got, 0, sizeof(got));
+	uint32_t seed = 1;
+
+	for (uint16_t i = 0; i < ObsTraceLength; i++) {
+		obsPayload p;
+		uint8_t len = traceReport(obsTrace[i], p);
+		time_t t = obsTrace[i].frameBase;
+		planner.enqueue(p.readAccess(), len, t);
+		if (!planner.plan(t, 5))
+			continue;
+		if (!lost(seed)) {
+			const uint8_t *frame = planner.frame();
+			obsPayload out;
+			if (planner.framePort() == TxPort_Single) {
+				memset(&out, 0, sizeof(out));
+				memcpy(out.readAccess(), frame, planner.frameLength());
+				receive(out, planner.frameLength(), got);
+			} else {
+				for (uint8_t pos = 0; pos < planner.frameLength(); pos += 1 + frame[pos]) {
+					memset(&out, 0, sizeof(out));
+					memcpy(out.readAccess(), &frame[pos + 1], frame[pos]);
+					receive(out, frame[pos], got);
+				}
+			}
+		}
+		planner.sent(t);
+	}
+	for (uint16_t i = 0; i < ObsTraceLength; i++)
+		plainRecovered += got[i];
+
+	char msg[80];
+	snprintf(msg, sizeof(msg), "port 1: %u/%u reports recovered", plainRecovered, (unsigned)ObsTraceLength);
+	TEST_MESSAGE(msg);
+}
+
+void test_no_redundancy(void) { replay(0); }
+void test_one_echo(void) { replay(1); }
+void test_two_echoes(void) { replay(2); }
+
+// Each port 4 frame decodes on its own, so a lost frame costs no more than a lost port 1 report
+void test_delta_loses_no_more_than_plain(void)
+{
+	TEST_ASSERT_GREATER_OR_EQUAL(plainRecovered, recovered[0]);
+}
+
+// Echoes cost airtime, so at DR5 a second one can crowd out frames: each
+// setting is held to the plain port 1 baseline rather than to the one before
+void test_echoes_recover_lost_reports(void)
+{
+	TEST_ASSERT_GREATER_THAN(plainRecovered, recovered[1]);
+	TEST_ASSERT_GREATER_THAN(plainRecovered, recovered[2]);
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_plain_reports);
+	RUN_TEST(test_no_redundancy);
+	RUN_TEST(test_one_echo);
+	RUN_TEST(test_two_echoes);
+	RUN_TEST(test_delta_loses_no_more_than_plain);
+	RUN_TEST(test_echoes_recover_lost_reports);
+	return UNITY_END();
+}
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""
+obs_trace.py - report traces for replaying through ObsCodec / TxPlanner
+
+A trace is a CSV file with one report per line (# comments allowed):
+  frameBase,gustOffset,windGustX10,windGustDir,tempX10,humidX10,pressX10,
+  rainflX10,windspX10,windDir,dailyRainX10,casetempX10[,rainPeakX10,firstTipOffset]
+i.e. the port 1 payload fields in order; the last two only when it rained.
+Reports decoded from a station's uplinks can be written in this form.
+
+  python3 tools/obs_trace.py synth [--reports N] [--seed S] > tools/traces/synthetic.csv
+  python3 tools/obs_trace.py header tools/traces/synthetic.csv > test/native/ObsTrace.h
+
+synth makes a repeatable synthetic trace at the 5 minute report interval:
+diurnal temperature, drifting pressure, humidity following temperature,
+gusty wind and rain episodes.  header turns a trace into the C table the
+native tests (pio test -e native) replay.
+"""
+
+import argparse
+import math
+import random
+import sys
+
+INTERVAL = 300
+FIELDS = 12                         # frameBase, gustOffset, 10 obsSet fields
+RAIN_FIELDS = 2
+
+
+def synth(reports, seed):
+    rng = random.Random(seed)
+    t = 1767225600                  # 2026-01-01 00:00 UTC
+    press = 1013.0
+    wind = 8.0
+    daily = 0
+    rain_left = 0
+    yield '# synthetic trace: %d reports, seed %d (tools/obs_trace.py synth)' % (reports, seed)
+    for i in range(reports):
+        t += INTERVAL
+        hour = (t // 3600 + 10) % 24                            # AEST
+        temp = 18 + 6 * math.sin((hour - 9) * math.pi / 12) + rng.gauss(0, 0.2)
+        press = min(max(press + rng.gauss(0, 0.15), 990), 1035)
+        humid = min(max(95 - 2.5 * (temp - 12) + rng.gauss(0, 1), 10), 100)
+        wind = min(max(wind + rng.gauss(0, 1.5), 0), 60)
+        speed = max(wind + rng.gauss(0, 2), 0)
+        gust = speed + abs(rng.gauss(0, 4)) + wind * 0.3
+        direction = int(200 + 40 * math.sin(i / 50.0) + rng.gauss(0, 15))
+        if hour == 9 and t % 3600 == 0:
+            daily = 0
+        if not rain_left and rng.random() < 0.004:
+            rain_left = rng.randint(6, 48)                      # 30 min to 4 hrs of rain
+        tips = rng.randint(0, 6) if rain_left else 0
+        rain_left = max(rain_left - 1, 0)
+        daily += tips
+        row = [t, -rng.randint(0, INTERVAL * 2),
+               int(gust * 10), (direction + rng.randint(-20, 20)) % 360,
+               int((temp + 100) * 10), int(humid * 10), int(press * 10),
+               int(tips * 0.2 * 3600 / INTERVAL * 10), int(speed * 10), direction % 360 + 90,
+               daily * 2, int((temp + 104) * 10)]
+        if tips:
+            row += [tips * 12 * 10 // 2 + rng.randint(0, 60), -rng.randint(0, INTERVAL * 2)]
+        yield ','.join(str(v) for v in row)
+
+
+def read_trace(path):
+    rows = []
+    with open(path) as f:
+        for line in f:
+            line = line.split('#')[0].strip()
+            if not line:
+                continue
+            row = [int(v) for v in line.split(',')]
+            if len(row) not in (FIELDS, FIELDS + RAIN_FIELDS):
+                sys.exit("%s: expected %d or %d fields: %s" % (path, FIELDS, FIELDS + RAIN_FIELDS, line))
+            rows.append(row)
+    return rows
+
+
+def header(path):
+    rows = read_trace(path)
+    yield '/*'
+    yield ' * ObsTrace.h - report trace for the native tests'
+    yield ' *'
+    yield ' * Generated by tools/obs_trace.py from %s - do not edit.' % path
+    yield ' */'
+    yield ''
+    yield '#ifndef ObsTrace_h'
+    yield '#define ObsTrace_h'
+    yield ''
+    yield '#include <string.h>'
+    yield '#include "ObsPayload.h"'
+    yield ''
+    yield 'struct ObsTraceRow {'
+    yield '    uint32_t frameBase;'
+    yield '    int16_t gustOffset;'
+    yield '    uint16_t obs[10];'
+    yield '    bool rain;'
+    yield '    uint16_t rainPeakX10;'
+    yield '    int16_t firstTipOffset;'
+    yield '};'
+    yield ''
+    yield 'static const ObsTraceRow obsTrace[] = {'
+    for r in rows:
+        rain = r[FIELDS:] or [0, 0]
+        yield '    { %d, %d, { %s }, %s, %d, %d },' % (r[0], r[1], ', '.join(str(v) for v in r[2:FIELDS]),
+                                                      'true' if len(r) > FIELDS else 'false', rain[0], rain[1])
+    yield '};'
+    yield ''
+    yield '#define ObsTraceLength  (sizeof(obsTrace) / sizeof(obsTrace[0]))'
+    yield ''
+    yield '// Port 1 report for a trace row; returns its length'
+    yield 'inline uint8_t traceReport(const ObsTraceRow &r, obsPayload &p)'
+    yield '{'
+    yield '    memset(&p, 0, sizeof(p));'
+    yield '    memcpy(&p.obsReport, r.obs, sizeof(obsSet));'
+    yield '    p.stamp.frameBase = r.frameBase;'
+    yield '    p.stamp.gustOffset = r.gustOffset;'
+    yield '    if (!r.rain)'
+    yield '        return sizeof(obsSet) + sizeof(obsStamp);'
+    yield '    p.rainExt.rainPeakX10 = r.rainPeakX10;'
+    yield '    p.rainExt.firstTipOffset = r.firstTipOffset;'
+    yield '    return sizeof(obsSet) + sizeof(obsStamp) + sizeof(obsRainExt);'
+    yield '}'
+    yield ''
+    yield '#endif'
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = ap.add_subparsers(dest='cmd', required=True)
+    s = sub.add_parser('synth', help='write a synthetic trace')
+    s.add_argument('--reports', type=int, default=2000)
+    s.add_argument('--seed', type=int, default=1)
+    h = sub.add_parser('header', help='write the C table of a trace')
+    h.add_argument('trace')
+    args = ap.parse_args()
+
+    lines = synth(args.reports, args.seed) if args.cmd == 'synth' else header(args.trace)
+    for line in lines:
+        print(line)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+"""
+vane_table.py - generate include/VaneTable.h from a wind vane calibration sweep
+
+The sweep is a CSV file of "adc,degrees" lines (# comments allowed), taken by
+turning the vane through a full circle and noting the averaged ADC reading at
+each known bearing.  Bearings are relative to the vane's own north; the mounting
+offset is added here (--offset) so the station needs no arithmetic for it.
+Without a sweep file the table is linear, as the old map(0..1023 -> 0..359).
+
+  python3 tools/vane_table.py [sweep.csv] [--offset DEG] > include/VaneTable.h
+"""
+
+import argparse
+import sys
+
+ADC_COUNTS = 1024
+SEGMENTS = 64                       # table has SEGMENTS + 1 entries, one every 16 counts
+STEP = ADC_COUNTS // SEGMENTS
+
+
+def read_sweep(path):
+    points = []
+    with open(path) as f:
+        for line in f:
+            line = line.split('#')[0].strip()
+            if not line:
+                continue
+            adc, deg = line.split(',')
+            points.append((float(adc), float(deg)))
+    if len(points) < 2:
+        sys.exit("need at least two calibration points")
+    points.sort()
+    # unwrap bearings so they increase with ADC counts round the circle
+    unwrapped = [points[0]]
+    for adc, deg in points[1:]:
+        while deg < unwrapped[-1][1]:
+            deg += 360
+        unwrapped.append((adc, deg))
+    return unwrapped
+
+
+def bearing(points, adc):
+    # linear between sweep points, and across the wrap from the last point back to the first
+    first, last = points[0], points[-1]
+    ring = [(last[0] - ADC_COUNTS, last[1] - 360)] + points + [(first[0] + ADC_COUNTS, first[1] + 360)]
+    for (a0, d0), (a1, d1) in zip(ring, ring[1:]):
+        if a0 <= adc <= a1:
+            return d0 if a1 == a0 else d0 + (d1 - d0) * (adc - a0) / (a1 - a0)
+    raise ValueError(adc)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('sweep', nargs='?', help='CSV of adc,degrees calibration points')
+    ap.add_argument('--offset', type=float, default=0, help='vane offset from north (deg), rounded & folded into the table')
+    args = ap.parse_args()
+
+    offset = int(round(args.offset))   # whole degrees - as VANE_TABLE_OFFSET, which the station trims against
+    points = read_sweep(args.sweep) if args.sweep else [(0, 0), (ADC_COUNTS / 2, 180)]
+    table = [int(round((bearing(points, i * STEP) + offset) * 10)) % 3600 for i in range(SEGMENTS + 1)]
+
+    source = args.sweep if args.sweep else 'linear (no sweep)'
+    print('/*')
+    print(' * VaneTable.h - wind vane ADC counts to bearing, tenths of a degree')
+    print(' *')
+    print(' * Generated by tools/vane_table.py - do not edit.')
+    print(' *   sweep:  %s' % source)
+    print(' *   offset: %d deg (VaneOffset)' % offset)
+    print(' * Entry i is the bearing at %d * i counts; VaneAdc::bearingX10() interpolates between.' % STEP)
+    print(' */')
+    print()
+    print('#ifndef VaneTable_h')
+    print('#define VaneTable_h')
+    print()
+    print('#define VANE_TABLE_OFFSET  %d\t\t// deg folded into the table - main.cpp\'s VaneOffset default' % offset)
+    print()
+    print('#ifdef VANE_TABLE_DATA\t\t\t// VaneAdc.cpp only - elsewhere just the offset')
+    print('static const uint16_t vaneTable[%d] PROGMEM = {' % (SEGMENTS + 1))
+    for row in range(0, len(table), 8):
+        print('\t' + ', '.join('%4d' % t for t in table[row:row + 8]) + ',')
+    print('};')
+    print('#endif')
+    print()
+    print('#endif')
+
+
+if __name__ == '__main__':
+    main()